@@ -0,0 +1,49 @@
+#include "Animator.h"
+
+Animator::Animator()
+{
+    reset();
+}
+
+void Animator::reset()
+{
+    _clock = 0;
+    
+    for (int i = 0; i < ANIM_COUNT; i++) {
+        _frame[i] = 0;
+        _left[i] = animations[i].frames[0].frames;
+    }
+}
+
+void Animator::tick()
+{
+    _clock++;
+    
+    for (int i = 0; i < ANIM_COUNT; i++) {
+        if (--_left[i] > 0) {
+            continue;
+        }
+        
+        const AnimClip &clip = animations[i];
+        
+        if (++_frame[i] == clip.frame_count) {
+            _frame[i] = 0; // clips loop
+        }
+        _left[i] = clip.frames[_frame[i]].frames;
+    }
+}
+
+const AnimFrame &Animator::frame(int anim) const
+{
+    return animations[anim].frames[_frame[anim]];
+}
+
+const PackedSprite *Animator::sprite(int anim) const
+{
+    return frame(anim).sprite;
+}
+
+unsigned int Animator::getClock() const
+{
+    return _clock;
+}
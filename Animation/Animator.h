@@ -0,0 +1,49 @@
+#ifndef ANIMATOR_H
+#define ANIMATOR_H
+
+#include "Clips.h"
+
+/** Animator Class
+ *
+ * @brief Plays every clip of the animations table off one frame clock. tick()
+ * @brief moves each clip on once a frame, so the cost is per clip, and an
+ * @brief entity finds its sprite with one lookup however many there are.
+ * @brief The timing is in game frames, it doesn't change with what's on screen.
+ */
+class Animator
+{
+    public:
+        /** Constructor, every clip on its first frame */
+        Animator();
+        
+        /** @brief back to the first frame of every clip, and the clock to 0
+         */
+        void reset();
+        
+        /** @brief call once a game frame, moves the clock and every clip on
+         */
+        void tick();
+        
+        /** @brief current frame of a clip
+         *  @param anim - an AnimId
+         */
+        const AnimFrame &frame(int anim) const;
+        
+        /** @brief sprite of the current frame of a clip
+         *  @param anim - an AnimId
+         *  @returns NULL if the frame draws nothing
+         */
+        const PackedSprite *sprite(int anim) const;
+        
+        /** @brief game frames since reset()
+         */
+        unsigned int getClock() const;
+        
+    private:
+    
+        unsigned int _clock;
+        uint8_t _frame[ANIM_COUNT]; // current frame of each clip
+        uint16_t _left[ANIM_COUNT]; // ticks until the next frame
+};
+
+#endif
@@ -0,0 +1,29 @@
+#include "Clips.h"
+#include "Sprites.h"
+
+// sprite, frames, flags, flip
+
+// one frame clips, the frog only turns for now. Right and down are the
+// other two mirrored
+static constexpr AnimFrame frog_up_frames[] = {{&frog_state_up_sprite, 1, 0, FLIP_NONE}};
+static constexpr AnimFrame frog_left_frames[] = {{&frog_state_left_sprite, 1, 0, FLIP_NONE}};
+static constexpr AnimFrame frog_right_frames[] = {{&frog_state_left_sprite, 1, 0, FLIP_X}};
+static constexpr AnimFrame frog_down_frames[] = {{&frog_state_up_sprite, 1, 0, FLIP_Y}};
+
+// about 23s a dive at 10.5 fps, the frog drowns for the second half
+static constexpr AnimFrame turtle_frames[] = {
+    {&turtles_state_one_sprite, 96, 0, FLIP_NONE},
+    {&turtles_state_two_sprite, 48, 0, FLIP_NONE},
+    {&turtles_state_two_sprite, 48, FRAME_SUBMERGED, FLIP_NONE},
+    {&turtles_state_three_sprite, 48, FRAME_SUBMERGED, FLIP_NONE},
+};
+
+#define FRAMES(table) table, sizeof(table) / sizeof(table[0])
+
+constexpr AnimClip animations[ANIM_COUNT] = {
+    {FRAMES(frog_up_frames)},
+    {FRAMES(frog_left_frames)},
+    {FRAMES(frog_right_frames)},
+    {FRAMES(frog_down_frames)},
+    {FRAMES(turtle_frames)},
+};
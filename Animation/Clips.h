@@ -0,0 +1,44 @@
+#ifndef CLIPS_H
+#define CLIPS_H
+
+#include "N5110.h"
+
+#include <stdint.h>
+
+/** flags of an animation frame, for the game to act on */
+enum FrameFlags
+{
+    FRAME_SUBMERGED = 1 << 0 /**< turtles under water, the frog can't stand on them */
+};
+
+/** one frame of an animation clip */
+struct AnimFrame
+{
+    const PackedSprite *sprite; /**< drawn for this frame, NULL for nothing */
+    uint16_t frames;            /**< how long it's shown, in game frames (FRAME_BUDGET_US) */
+    uint8_t flags;              /**< FrameFlags */
+    uint8_t flip;               /**< SpriteFlip the sprite is drawn with */
+};
+
+/** a looping animation, constant data that stays in flash */
+struct AnimClip
+{
+    const AnimFrame *frames; /**< frames in the order they're shown */
+    uint8_t frame_count;     /**< number of frames */
+};
+
+/** index of each clip in the animations table, the frog's are in the order of Frogger::state_frog */
+enum AnimId
+{
+    ANIM_FROG_UP,    /**< frog facing up, state 0 */
+    ANIM_FROG_LEFT,  /**< state 1 */
+    ANIM_FROG_RIGHT, /**< state 2 */
+    ANIM_FROG_DOWN,  /**< state 3 */
+    ANIM_TURTLES,    /**< turtles surface, dive and come back up */
+    ANIM_COUNT
+};
+
+/** every animation of the game, indexed by AnimId */
+extern const AnimClip animations[ANIM_COUNT];
+
+#endif
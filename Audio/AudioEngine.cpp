@@ -0,0 +1,243 @@
+#include "AudioEngine.h"
+
+static_assert(AUDIO_VOICES <= 1 << AUDIO_MIX_SHIFT, "the mix would clip");
+
+// keeps the voice set up in startVoice() before the store that hands it to
+// the mixer interrupt
+#define COMPILER_BARRIER() __asm__ volatile("" ::: "memory")
+
+// one period of each Wave, -127 to 127
+static const int8_t wavetables[WAVE_COUNT][1 << AUDIO_WAVE_BITS] = {
+    // WAVE_SQUARE
+    {
+         127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+         127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+        -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+        -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+    },
+    // WAVE_TRIANGLE
+    {
+           0,    8,   16,   24,   32,   40,   48,   56,   64,   71,   79,   87,   95,  103,  111,  119,
+         127,  119,  111,  103,   95,   87,   79,   71,   64,   56,   48,   40,   32,   24,   16,    8,
+           0,   -8,  -16,  -24,  -32,  -40,  -48,  -56,  -64,  -71,  -79,  -87,  -95, -103, -111, -119,
+        -127, -119, -111, -103,  -95,  -87,  -79,  -71,  -64,  -56,  -48,  -40,  -32,  -24,  -16,   -8,
+    },
+    // WAVE_SINE
+    {
+           0,   12,   25,   37,   49,   60,   71,   81,   90,   98,  106,  112,  117,  122,  125,  126,
+         127,  126,  125,  122,  117,  112,  106,   98,   90,   81,   71,   60,   49,   37,   25,   12,
+           0,  -12,  -25,  -37,  -49,  -60,  -71,  -81,  -90,  -98, -106, -112, -117, -122, -125, -126,
+        -127, -126, -125, -122, -117, -112, -106,  -98,  -90,  -81,  -71,  -60,  -49,  -37,  -25,  -12,
+    },
+    // WAVE_NOISE, from a 16 bit LFSR
+    {
+         -84,   34,   71,   55,  -60,  -99,  -29,   21, -120,   82,  -17,   22,   62,  -95,   95,   64,
+          65,   50,   11,  -63,   96,  -17,   47, -106,  -48,   37,   48,  -87,   19,  -85,  -19,   25,
+         100,  -68,   18,  -47,   -4, -103,  115, -112,  -30,  114, -111, -117,   91,  -60,  -28,   75,
+          62,  -30,  -25,  -39,  109,  122,  104,   40,   60,   70,   69, -107,   22,   86,  -31,   35,
+    },
+};
+
+AudioEngine::AudioEngine()
+    :
+    _pending_count(0),
+    _dropped(0),
+    _gamepad(NULL)
+{
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        _voices[i].active = false;
+        _voices[i].clip = NULL;
+    }
+}
+
+void AudioEngine::start(Gamepad *gamepad)
+{
+    _gamepad = gamepad;
+    _ticker.attach_us(callback(this, &AudioEngine::tick), 1000000 / AUDIO_SAMPLE_RATE);
+}
+
+void AudioEngine::stop()
+{
+    _ticker.detach();
+
+    if (_gamepad) {
+        _gamepad->write_dac_u16(32768); // no click when it starts again
+    }
+}
+
+void AudioEngine::playMusic(const AudioClip *clip)
+{
+    if (_voices[0].active && _voices[0].clip == clip) {
+        return; // already playing, don't start it again
+    }
+    startVoice(0, clip);
+}
+
+void AudioEngine::stopMusic()
+{
+    _voices[0].active = false;
+}
+
+bool AudioEngine::playEffect(const AudioClip *clip)
+{
+    int voice = freeEffectVoice();
+    if (voice < 0) {
+        // a new effect is more relevant than an old one of the same priority
+        int lowest = lowestEffectVoice();
+        if (clip->priority >= _voices[lowest].clip->priority) {
+            voice = lowest;
+        }
+    }
+    if (voice >= 0) {
+        startVoice(voice, clip);
+        return true;
+    }
+
+    // every voice is busy with something more important, wait for one
+    int i = _pending_count;
+    if (i == AUDIO_PENDING) {
+        if (clip->priority <= _pending[i - 1]->priority) {
+            _dropped++;
+            return false;
+        }
+        _dropped++; // the lowest waiting effect makes room
+        i--;
+    } else {
+        _pending_count++;
+    }
+
+    // insertion sort, highest priority first, in order of arrival within one
+    while (i > 0 && _pending[i - 1]->priority < clip->priority) {
+        _pending[i] = _pending[i - 1];
+        i--;
+    }
+    _pending[i] = clip;
+    return true;
+}
+
+void AudioEngine::update()
+{
+    while (_pending_count > 0) {
+        int voice = freeEffectVoice();
+        if (voice < 0) {
+            return;
+        }
+        startVoice(voice, _pending[0]);
+
+        _pending_count--;
+        for (int i = 0; i < _pending_count; i++) {
+            _pending[i] = _pending[i + 1];
+        }
+    }
+}
+
+uint16_t AudioEngine::mix()
+{
+    int32_t sum = 0;
+
+    for (int i = 0; i < AUDIO_VOICES; i++) {
+        Voice &v = _voices[i];
+        if (!v.active) {
+            continue;
+        }
+
+        // the top bits of the phase index the wavetable
+        sum += v.wave[v.phase >> (32 - AUDIO_WAVE_BITS)] * v.volume;
+        v.phase += v.step;
+
+        if (--v.remaining == 0) {
+            nextNote(v);
+        }
+    }
+    return 32768 + (sum >> AUDIO_MIX_SHIFT);
+}
+
+bool AudioEngine::isPlaying()
+{
+    for (int i = 1; i < AUDIO_VOICES; i++) {
+        if (_voices[i].active) {
+            return true;
+        }
+    }
+    return _pending_count > 0;
+}
+
+int AudioEngine::getDropped()
+{
+    return _dropped;
+}
+
+// mixer interrupt, AUDIO_SAMPLE_RATE times a second
+void AudioEngine::tick()
+{
+    _gamepad->write_dac_u16(mix());
+}
+
+void AudioEngine::startVoice(int voice, const AudioClip *clip)
+{
+    Voice &v = _voices[voice];
+
+    v.active = false; // the mixer leaves it alone until it's set up
+    COMPILER_BARRIER();
+
+    v.clip = clip;
+    v.wave = wavetables[clip->wave];
+    v.phase = 0;
+    v.note = 0;
+    loadNote(v);
+
+    COMPILER_BARRIER();
+    v.active = true;
+}
+
+void AudioEngine::loadNote(Voice &v)
+{
+    const AudioNote &note = v.clip->notes[v.note];
+
+    v.step = note.hz * AUDIO_STEP_PER_HZ; // no divide, the interrupt calls this
+    v.volume = note.hz ? v.clip->volume : 0; // rests are silent
+    v.remaining = note.ms * (AUDIO_SAMPLE_RATE / 1000);
+
+    if (v.remaining == 0) {
+        v.remaining = 1;
+    }
+}
+
+// from the mixer interrupt, at the end of a note
+void AudioEngine::nextNote(Voice &v)
+{
+    v.note++;
+
+    if (v.note == v.clip->note_count) {
+        if (!v.clip->repeat) {
+            v.active = false; // free for the next effect
+            return;
+        }
+        v.note = 0;
+    }
+    loadNote(v);
+}
+
+// first sound effect voice that isn't playing, -1 if they all are
+int AudioEngine::freeEffectVoice()
+{
+    for (int i = 1; i < AUDIO_VOICES; i++) {
+        if (!_voices[i].active) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// sound effect voice playing the lowest priority effect
+int AudioEngine::lowestEffectVoice()
+{
+    int lowest = 1;
+
+    for (int i = 2; i < AUDIO_VOICES; i++) {
+        if (_voices[i].clip->priority < _voices[lowest].clip->priority) {
+            lowest = i;
+        }
+    }
+    return lowest;
+}
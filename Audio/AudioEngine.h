@@ -0,0 +1,137 @@
+#ifndef AUDIOENGINE_H
+#define AUDIOENGINE_H
+
+#include "mbed.h"
+#include "Gamepad.h"
+
+#include <stdint.h>
+
+#define AUDIO_SAMPLE_RATE 8000 // samples a second written to the DAC
+#define AUDIO_VOICES 4 // voice 0 plays the music, the rest the sound effects
+#define AUDIO_MIX_SHIFT 2 // AUDIO_VOICES full scale voices still fit the DAC
+#define AUDIO_PENDING 4 // sound effects waiting for a voice
+#define AUDIO_WAVE_BITS 6 // wavetables have 2^6 samples
+#define AUDIO_STEP_PER_HZ 536871u // phase step of 1Hz, 2^32 / AUDIO_SAMPLE_RATE
+
+/** wavetables a clip can be played with */
+enum Wave
+{
+    WAVE_SQUARE,   /**< the buzzer's loudest */
+    WAVE_TRIANGLE, /**< softer */
+    WAVE_SINE,     /**< softest */
+    WAVE_NOISE,    /**< for splashes and crashes */
+    WAVE_COUNT
+};
+
+/** one note of a clip */
+struct AudioNote
+{
+    uint16_t hz; /**< frequency, 0 for a rest */
+    uint16_t ms; /**< length */
+};
+
+/** a tune or a sound effect, constant data that stays in flash */
+struct AudioClip
+{
+    const AudioNote *notes; /**< notes in the order they're played */
+    uint8_t note_count;     /**< number of notes */
+    uint8_t wave;           /**< a Wave */
+    uint8_t volume;         /**< 0 to 255 */
+    uint8_t priority;       /**< a higher priority effect can cut a lower one off */
+    bool repeat;            /**< starts again after the last note */
+};
+
+/** AudioEngine Class
+ *
+ * @brief Fixed rate software synthesiser on the DAC. A Ticker runs the mixer at
+ * @brief AUDIO_SAMPLE_RATE whatever is playing: each voice steps an integer phase
+ * @brief accumulator through a wavetable, the voices are summed and written to
+ * @brief the DAC. There's no float, divide or modulo per sample, so the interrupt
+ * @brief costs the same at any pitch and takes a fixed share of the CPU.
+ * @brief Sound effects go to a free voice, cut off a lower priority one, or wait
+ * @brief in a small priority queue until update() finds them a voice.
+ */
+class AudioEngine
+{
+    public:
+        /** Constructor, silent until start() */
+        AudioEngine();
+
+        /** @brief starts the mixer interrupt
+         *  @param gamepad - owner of the DAC, already initialised
+         */
+        void start(Gamepad *gamepad);
+
+        /** @brief stops the mixer interrupt and leaves the DAC at its midpoint
+         */
+        void stop();
+
+        /** @brief loops a tune on the music voice, carries on if it's already playing
+         *  @param clip - the tune
+         */
+        void playMusic(const AudioClip *clip);
+
+        /** @brief silences the music voice
+         */
+        void stopMusic();
+
+        /** @brief plays a sound effect
+         *  @param clip - the effect
+         *  @returns false if every voice and the queue are taken by higher
+         *  @returns priority effects, it's dropped and counted
+         */
+        bool playEffect(const AudioClip *clip);
+
+        /** @brief call once a frame, starts the waiting effects on the voices
+         *  @brief that have finished
+         */
+        void update();
+
+        /** @brief next sample of the mix, the mixer interrupt calls it
+         *  @returns DAC value, 0 to 65535
+         */
+        uint16_t mix();
+
+        /** @brief true if a sound effect is playing or waiting
+         */
+        bool isPlaying();
+
+        /** @brief number of effects dropped because nothing had a lower priority
+         */
+        int getDropped();
+
+    private:
+
+        /** one voice. The main loop only writes a voice while it isn't active,
+         *  the mixer interrupt only reads it while it is and clears active when
+         *  a clip ends, like the Gamepad's event ring
+         */
+        struct Voice
+        {
+            uint32_t phase;
+            uint32_t step;          // phase step of the note, 0 for a rest
+            uint32_t remaining;     // samples left of the note
+            const int8_t *wave;
+            int32_t volume;
+            const AudioClip *clip;
+            uint8_t note;           // index of the note in clip
+            volatile bool active;
+        };
+
+        void tick();
+        void startVoice(int voice, const AudioClip *clip);
+        void loadNote(Voice &v);
+        void nextNote(Voice &v);
+        int freeEffectVoice();
+        int lowestEffectVoice();
+
+        Voice _voices[AUDIO_VOICES];
+        const AudioClip *_pending[AUDIO_PENDING]; // highest priority first
+        int _pending_count;
+        int _dropped;
+
+        Gamepad *_gamepad;
+        Ticker _ticker;
+};
+
+#endif
@@ -0,0 +1,34 @@
+#include "Sounds.h"
+
+// hz, ms
+static constexpr AudioNote hop_notes[] = {
+    {NOTE_A5, 20}, {NOTE_E6, 30},
+};
+
+static constexpr AudioNote squash_notes[] = {
+    {200, 60}, {120, 120},
+};
+
+static constexpr AudioNote splash_notes[] = {
+    {600, 40}, {400, 60}, {250, 100},
+};
+
+static constexpr AudioNote level_complete_notes[] = {
+    {NOTE_C5, 100}, {NOTE_E5, 100}, {NOTE_G5, 100}, {NOTE_C6, 300},
+};
+
+static constexpr AudioNote theme_notes[] = {
+    {NOTE_C5, 150}, {0, 50}, {NOTE_E5, 150}, {0, 50}, {NOTE_G5, 150}, {0, 50}, {NOTE_E5, 150}, {0, 50},
+    {NOTE_F5, 150}, {0, 50}, {NOTE_A5, 150}, {0, 50}, {NOTE_G5, 350}, {0, 250},
+    {NOTE_E5, 150}, {0, 50}, {NOTE_D5, 150}, {0, 50}, {NOTE_C5, 150}, {0, 50}, {NOTE_D5, 150}, {0, 50},
+    {NOTE_E5, 150}, {0, 50}, {NOTE_D5, 150}, {0, 50}, {NOTE_C5, 350}, {0, 650},
+};
+
+#define NOTES(table) table, sizeof(table) / sizeof(table[0])
+
+// notes, wave, volume, priority, repeat
+constexpr AudioClip sound_hop = {NOTES(hop_notes), WAVE_SQUARE, 120, PRIORITY_MOVE, false};
+constexpr AudioClip sound_squash = {NOTES(squash_notes), WAVE_NOISE, 255, PRIORITY_DEATH, false};
+constexpr AudioClip sound_splash = {NOTES(splash_notes), WAVE_NOISE, 200, PRIORITY_DEATH, false};
+constexpr AudioClip sound_level_complete = {NOTES(level_complete_notes), WAVE_SQUARE, 200, PRIORITY_LEVEL, false};
+constexpr AudioClip theme_music = {NOTES(theme_notes), WAVE_TRIANGLE, 100, PRIORITY_MOVE, true};
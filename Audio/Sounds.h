@@ -0,0 +1,29 @@
+#ifndef SOUNDS_H
+#define SOUNDS_H
+
+#include "AudioEngine.h"
+
+/** priority of each kind of sound effect, a higher one cuts a lower one off */
+enum SoundPriority
+{
+    PRIORITY_MOVE,  /**< the frog hops, there's one every press */
+    PRIORITY_DEATH, /**< the frog was squashed or drowned */
+    PRIORITY_LEVEL  /**< a level was completed */
+};
+
+/** the frog hops */
+extern const AudioClip sound_hop;
+
+/** the frog was hit by a vehicle */
+extern const AudioClip sound_squash;
+
+/** the frog fell in the water or the void, or was carried off the screen */
+extern const AudioClip sound_splash;
+
+/** the frog made it to the top */
+extern const AudioClip sound_level_complete;
+
+/** tune of the main menu, loops */
+extern const AudioClip theme_music;
+
+#endif
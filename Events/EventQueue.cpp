@@ -0,0 +1,61 @@
+#include "EventQueue.h"
+
+EventQueue::EventQueue()
+    :
+    _head(0),
+    _size(0),
+    _dropped(0)
+{}
+
+bool EventQueue::push(int type, int lane, int object)
+{
+    if (_size == EVENT_QUEUE_SIZE) {
+        _dropped++;
+        return false;
+    }
+    
+    GameEvent &event = _events[(_head + _size) % EVENT_QUEUE_SIZE];
+    event.type = type;
+    event.lane = lane;
+    event.object = object;
+    _size++;
+    return true;
+}
+
+bool EventQueue::pop(GameEvent &event)
+{
+    if (_size == 0) {
+        return false;
+    }
+    
+    event = _events[_head];
+    _head = (_head + 1) % EVENT_QUEUE_SIZE;
+    _size--;
+    return true;
+}
+
+bool EventQueue::contains(int type)
+{
+    for (int i = 0; i < _size; i++) {
+        if (_events[(_head + i) % EVENT_QUEUE_SIZE].type == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int EventQueue::size()
+{
+    return _size;
+}
+
+void EventQueue::clear()
+{
+    _head = 0;
+    _size = 0;
+}
+
+int EventQueue::getDropped()
+{
+    return _dropped;
+}
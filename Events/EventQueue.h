@@ -0,0 +1,81 @@
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <stdint.h>
+
+#define EVENT_QUEUE_SIZE 16 // events of one frame, a few are enough
+#define NO_OBJECT -1 // lane/object of events that don't come from an object
+
+/** outcomes of one frame of the simulation */
+enum GameEventType
+{
+    EVENT_COLLISION,      /**< the frog touched an object */
+    EVENT_RIDE_LOG,       /**< the frog is on a log or turtle and moves with it */
+    EVENT_DROWN,          /**< the frog fell in the water or the void */
+    EVENT_SQUASH,         /**< the frog was hit by a vehicle */
+    EVENT_OFF_SCREEN,     /**< the frog was carried off the screen */
+    EVENT_REACH_GOAL,     /**< the frog touched something on the goal row */
+    EVENT_LEVEL_COMPLETE, /**< the frog made it to the top */
+};
+
+/** one event, with the object that caused it */
+struct GameEvent
+{
+    uint8_t type;  /**< a GameEventType */
+    int8_t lane;   /**< lane of the object in the LaneTable, or NO_OBJECT */
+    int8_t object; /**< index of the object in the LaneTable's x, or NO_OBJECT */
+};
+
+/** EventQueue Class
+ *
+ * @brief Fixed capacity FIFO of game events. The simulation pushes what happened
+ * @brief while it walks the lanes, without touching the frog or the game state.
+ * @brief One resolution pass at the end of the frame pops and acts on them, so
+ * @brief sound, LEDs and the HUD have one place to hook into.
+ */
+class EventQueue
+{
+    public:
+        /** Constructor, empty */
+        EventQueue();
+        
+        /** @brief adds an event at the back
+         *  @param type - a GameEventType
+         *  @param lane - lane of the object, or NO_OBJECT
+         *  @param object - index of the object, or NO_OBJECT
+         *  @returns false if the queue is full, the event is dropped and counted
+         */
+        bool push(int type, int lane = NO_OBJECT, int object = NO_OBJECT);
+        
+        /** @brief removes the event at the front
+         *  @param event - set to the event
+         *  @returns false if the queue is empty
+         */
+        bool pop(GameEvent &event);
+        
+        /** @brief true if an event of this type is waiting
+         *  @param type - a GameEventType
+         */
+        bool contains(int type);
+        
+        /** @brief number of events waiting
+         */
+        int size();
+        
+        /** @brief removes every event
+         */
+        void clear();
+        
+        /** @brief number of events dropped because the queue was full
+         */
+        int getDropped();
+        
+    private:
+    
+        GameEvent _events[EVENT_QUEUE_SIZE];
+        int _head; // index of the front event
+        int _size;
+        int _dropped;
+};
+
+#endif
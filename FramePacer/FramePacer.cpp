@@ -0,0 +1,58 @@
+#include "FramePacer.h"
+
+FramePacer::FramePacer(int budget_us)
+    :
+    _budget_us(budget_us),
+    _work_us(0),
+    _overruns(0),
+    _frames(0)
+{}
+
+void FramePacer::start()
+{
+    _work_us = 0;
+    _overruns = 0;
+    _frames = 0;
+    
+    _timer.reset();
+    _timer.start();
+}
+
+void FramePacer::endFrame()
+{
+    _work_us = _timer.read_us();
+    
+    if (_work_us < _budget_us) {
+        wait_us(_budget_us - _work_us); // sleep off the rest of the frame
+    } else {
+        _overruns++; // already late, start the next frame straight away
+    }
+    
+    _timer.reset(); // next frame starts now, the timer keeps running
+    _frames++;
+}
+
+void FramePacer::setBudget(int budget_us)
+{
+    _budget_us = budget_us;
+}
+
+int FramePacer::getBudget()
+{
+    return _budget_us;
+}
+
+int FramePacer::getWorkTime()
+{
+    return _work_us;
+}
+
+int FramePacer::getOverruns()
+{
+    return _overruns;
+}
+
+int FramePacer::getFrameCount()
+{
+    return _frames;
+}
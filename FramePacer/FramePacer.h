@@ -0,0 +1,64 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include "mbed.h"
+
+/** FramePacer Class
+ *
+ * @brief Fixed timestep frame scheduler. Measures how long each frame's work
+ * @brief took on a microsecond timer and only waits for what's left of the
+ * @brief frame budget, so the frame rate doesn't drift with the workload.
+ * @brief Frames that run over the budget are counted and not waited on.
+ */
+class FramePacer
+{
+    public:
+        /** Constructor
+         * @param budget_us - length of one frame in microseconds
+         */
+        FramePacer(int budget_us);
+        
+        /** @brief starts timing the first frame
+         */
+        void start();
+        
+        /** @brief call once at the end of every frame, waits out the rest of
+         *  @brief the budget and starts timing the next frame
+         */
+        void endFrame();
+        
+        /** @brief change the frame budget
+         *  @param budget_us - length of one frame in microseconds
+         */
+        void setBudget(int budget_us);
+        
+        /** @brief length of one frame in microseconds
+         */
+        int getBudget();
+        
+        /** @brief time spent on the work of the last frame in microseconds, 
+         *  @brief not counting the wait
+         */
+        int getWorkTime();
+        
+        /** @brief number of frames whose work took longer than the budget
+         */
+        int getOverruns();
+        
+        /** @brief number of frames ended since start()
+         */
+        int getFrameCount();
+        
+    private:
+    
+        /** @brief measures the current frame, reset at every frame boundary
+         */
+        Timer _timer;
+        
+        int _budget_us;
+        int _work_us;
+        int _overruns;
+        int _frames;
+};
+
+#endif
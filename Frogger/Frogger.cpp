@@ -1,886 +1,698 @@
-#include "Frogger.h"
-
-// level one initiailization has already been done
-Frogger::Frogger(Frog *frog, int grid, int w, int h)
-{
-    this->frog = frog; // one frog object per run
-    
-    current_level = 1;
-    initializeParams(w, h, grid); // initialize the software parameters
-    initializeEmbeddedSystem(); // initialize the hardware paramaters
-    setupLevelOne();
-
-    intro.selection = 0;
-    intro.tutorial_screens = 0;
-
-    introScreen = true;
-    nextLevel = false;
-    play_game = false;
-    tutorial = false;
-    settings = false;
-}
-
-GraphicEngine graphics;
-
-void Frogger::initializeParams(int w, int h, int grid)
-{
-    // screen sizes
-    lcd_w = w; // width
-    lcd_h = h; // height
-    state_frog = 0;
-    end_post = false;
-    turtle_state = 0;
-    
-    water_level = 48- 4*6; // row 7 and up is the water level
-    frogDie = false;
-    frogOnLog = false;
-    goal_post_xpos = (36); // generate random position for end post
-    next_goal = false;
-    
-    // grid values
-    grid = 4; // size of game grid system
-    grid_width = 22; // size of screen width in grid units
-}
-
-void Frogger::initializeLevelTwo()
-{
-    setupLevelTwo();
-}
-
-void Frogger::initializeEmbeddedSystem()
-{
-    //game setup
-    graphics.init(); // initialize the LCD object
-    graphics.contrast(); // set the contrast to 0.4
-    graphics.backLightOn(); // turn on the backlight
-
-    gamepad.init();  // initialize the actual embedded system 
-}
-
-void Frogger::setupLevelOne()
-{
-    // vehicle objects
-    setupLevelOneRow();
-    setupLevelOneXPos();
-    setupLevelOneSprites();    
-    setupLevelOneDir();
-   
-    // log objects
-    setupLogsLevelOne();
-}
-
-// called by frogger engine
-void Frogger::setupLevelTwo()
-{
-    // setup vehicles
-    setupLevelTwoRows();
-    setupLevelTwoXPos();
-    setupLevelTwoSprites();  
-    setupLevelTwoDir();
-
-    //log objects    
-    setupLogLevelTwo();
-}
-
-void Frogger::setupBonusRound()
-{
-    setupBonusRows();
-    setupBonusXpos();
-    setupBonusTwoDir();
-    setupBonusSprites();
-}
-
-/* SETUP CALLS */
-void Frogger::setupLogsLevelOne()
-{
-    setLogLevelOneXPos();
-    setLogLevelOneRow();
-    setLogLevelOneDir();
-    setLogLevelOneSprites();
-}
-
-void Frogger::setupLogLevelTwo()
-{
-    setLogLevelTwoXPos();
-    setLogLevelTwoRow();
-    setLogLevelTwoSprite();
-    setLogLevelTwoDir();
-}
-/* SETUP CALLS */
-
-//main function that starts the game
-void Frogger::start()
-{     
-    //keep reading and processing user input
-    while(1) {
-        graphics.clear(); // clear the lcd screen 
-        if(introScreen) { // shows tutorial, setting
-            graphics.getPointerPos(intro.selection); // draw the initial pointer pos
-            home(); // draw menu selections
-        } else if (play_game) { // shows actual gameplay
-            run();
-            //printf("show turtle state %d" turtle_state);
-        } else if(tutorial) {
-            gotoPage();
-        } else if(bonus_round) {
-            run_bonus();
-        }   
-        graphics.refresh(); // refresh the lcd screen
-        wait_ms(85); // fpms
-    } 
-}
-
-void Frogger::displayIntro()
-{
-    graphics.introOne();
-    wait_ms(10);
-    graphics.refresh(); // refresh the lcd screen
-
-    graphics.refresh(); // refresh the lcd screen
-    graphics.clear();
-    graphics.introTwo();
-    wait_ms(3000);
-    graphics.refresh(); // refresh the lcd screen
-
-    graphics.refresh(); // refresh the lcd screen
-    graphics.clear();
-    wait_ms(5000);
-    graphics.refresh(); // refresh the lcd screen 
-}
-
-void Frogger::displayLevelIntro()
-{
-    graphics.clear();
-    graphics.newLevel1();
-    wait_ms(1000);
-    graphics.refresh(); // refresh the lcd screen
-
-    graphics.refresh(); // refresh the lcd screen
-    graphics.clear();
-    graphics.newLevel2();
-    wait_ms(1000);
-    graphics.refresh(); // refresh the lcd screen
-
-    graphics.refresh(); // refresh the lcd screen
-    graphics.clear();
-    wait_ms(1000);
-    graphics.refresh(); // refresh the lcd screen
-}
-
-void Frogger::run()
-{
-    checkProgression();
-    
-    //printf("FROG y position, %d", frog->y);
-    //printf("Display the current level, %d", current_level);   
-
-    drawBackGround();
-        
-    generateLevelOneGoalPost();
-            
-    process_input(); // user controls the frog object
-       
-    actOnFrogPos();
-        
-    graphics.showFrog(frog->x, frog->y, frog->width, frog->height, state_frog); // display current position of frog 
-}
-
-void Frogger::run_bonus()
-{
-    current_level = 0;
-    checkBonusProgress(); 
-      
-    //printf("FROG y position, %d", frog->y);
-    //printf("Display the current level, %d", current_level); 
-    
-    drawBackGround();    
-    generateLevelOneGoalPost();     
-    process_input(); // user controls the frog object
-    actOnFrogBonus();
-    checkFrogInDeathZone();
-
-    graphics.showFrog(frog->x, frog->y, frog->width, frog->height, state_frog); // display current position of frog 
-    graphics.drawVoidBackGround();
-}
-
-void Frogger::checkFrogInDeathZone()
-{
-    if(frog->x < 35 || frog->x > 55)
-    {
-        frog->reset();
-    }
-}
-
-void Frogger::checkProgression()
-{ 
-    if((frog->y == 48 - 4*11 || frog->y == 48 - 4*10)){
-        displayLevelIntro();
-        frog->reset();
-        setupLevelTwo();
-        current_level++;
-    }
-}
-
-void Frogger::checkBonusProgress()
-{ 
-    if((frog->y == 48 - 4*11 || frog->y == 48 - 4*10)){
-        frog->reset();
-        setupLevelOne();
-        current_level++;
-        bonus_round = false;
-        introScreen = true;
-    }
-}
-
-void Frogger::actOnFrogPos()
-{
-    if(frog->y >= water_level)
-    {
-        frogDie = false;
-        runCurrentLevel(); // add velocity to level vehicles and logs
-
-    } else {
-        frogDie = true;
-        runCurrentLevel(); // add velocity to level vehicles and logs
-            
-        if((!frogOnLog) && (frog->y != 48 - 4*11 && frog->y != 48 - 4*10) && frog->x != 42){
-            frog->reset();
-        }
-    }
-}
-
-void Frogger::actOnFrogBonus()
-{
-    if(frog->y != 48 - 4*11 && (frog->y != 48 - 4*10)) {     
-        runCurrentLevel();
-        graphics.drawVoidBackGround();
-    } 
-}
-
-void Frogger::home()
-{
-    determineSelection();
-    graphics.drawMenu();   
-}
-
-void Frogger::determineSelection()
-{
-   if(intro.selection < 2 && gamepad.B_pressed()){
-        graphics.getPointerPos(intro.selection++);
-
-    } else if(intro.selection > 0 && gamepad.X_pressed()){
-        graphics.getPointerPos(intro.selection--);
-    }
-    
-    //printf("Current user selection,%d", intro.selection);
-    
-    wait_ms(10);
-
-    if(gamepad.A_pressed())
-    {
-        gotoPage();
-    }
-}
-
-void Frogger::gotoPage()
-{
-    switch(intro.selection)
-    {
-        case 0:
-            play_game = true;
-            introScreen = false;
-            tutorial = false;
-            settings = false;
-            break;
-        case 1:
-            displayTutorial();
-            play_game = false;  
-            introScreen = false;
-            tutorial = true;
-            settings = false;
-            break;
-        case 2: // bonus round
-            setupBonusRound();
-            bonus_round = true;
-            play_game = false;
-            introScreen = false;
-            tutorial = false;
-            settings = false;
-            break;
-    }
-}
-
-void Frogger::displayTutorial()
-{
-    wait_ms(15);  
-
-    switch(intro.tutorial_screens)
-    {
-        case 0:
-            graphics.drawTutor1();
-            gotoNextTutorialSlide();
-            break;
-        case 1:
-            graphics.drawTutor2();
-            gotoNextTutorialSlide();
-            break;
-        case 2:
-            graphics.drawTutor3();
-            gotoNextTutorialSlide();
-            break;
-        default:
-            home();
-            intro.selection = 0;            
-    }
-}
-
-void Frogger::gotoNextTutorialSlide()
-{
-    if(gamepad.A_pressed()){
-        intro.tutorial_screens++;
-        wait_ms(25);  
-    }
-    
-    if(intro.tutorial_screens > 2){
-        intro.tutorial_screens = 7;
-        tutorial = false;
-    }
-    
-    //printf("Current tutorial screen, %d" intro.tutorial_screen);
-}
-
-void Frogger::drawBackGround()
-{
-    graphics.drawDangerZone();
-    graphics.drawSafetyLanes(); 
-}
-
-void Frogger::generateLevelOneGoalPost()
-{
-    graphics.drawEndPost(goal_post_xpos);
-}
-
-int Frogger::randEndPost()
-{
-    return (rand() % 80) + 12;      
-}
-
-
-
-void Frogger::process_input() {
-    //determine the input 
-    if(gamepad.A_pressed()){
-        state_frog = 1;
-        moveFrog(1,0); // move frog right
-        frogOnLog = false;
-    } else if(gamepad.X_pressed()){
-        state_frog = 0;
-        moveFrog(0,-1);// move it down
-        frogOnLog = false;
-    } else if(gamepad.B_pressed()){
-        state_frog = 3;
-        moveFrog(0,1); // move the frog up
-        frogOnLog = false;
-    } else if(gamepad.Y_pressed()){
-        state_frog = 2;
-        moveFrog(-1,0); // move the frog left
-        frogOnLog = false;
-    } 
-    wait_ms(10);
-}
-
-void Frogger::drawFrogStates()
-{
-    state_frog++;
-    graphics.showFrog(frog->x, frog->y, frog->width, frog->height, state_frog); // display current position of frog
-    state_frog--;
-}
-
-//moves the frog around the grid
-void Frogger::moveFrog(int xWay, int yWay)
-{
-    //increment the left side of the chicken by a value of the grid size
-    frog->x += xWay * 4;
-    // printf("Current frog x, %d", frog->x);
-    
-    //increment the top side by a value of grid sizw
-    frog->y += yWay * 4;
-    // printf("Current frog y, %d", frog->y);
-
-    // update rect parameters
-    frog->left_side = frog->x;
-    frog->right_side = 6 + frog->x;
-    frog->up = frog->y;
-    frog->down = 4 + frog->y;
-    
-    //frog->test_frog();
-}
-
-/* ENGINE CALLS */
-void Frogger::runCurrentLevel()
-{
-    switch (current_level)
-    {
-        case 0:
-            runBonusRound();
-            break;
-        case 1:
-            runLevelOne();
-            break;
-        case 2:
-            runLevelTwo();
-            break;
-    }
-}
-
-void Frogger::runLevelOne()
-{
-    moveVehiclesLevelOne(); // increment the x pos and display
-    moveLogsLevelOne();  
-}
-
-void Frogger::runLevelTwo()
-{
-    moveVehiclesLevelTwo();
-    moveLogsLevelTwo();
-}
-
-void Frogger::runBonusRound()
-{
-    moveBonusObjects();
-}
-/* ENGINE CALLS */
-
-/* ENGINE RUN */
-void Frogger::moveVehiclesLevelOne()
-{
-    moveVehicle(car_row_one_one, 'S', 3);
-    moveVehicle(car_row_two_one, 'M', 2);
-    moveVehicle(car_row_three_one, 'S', 3);
-    moveVehicle(car_row_four_one, 'M', 4);    
-}
-
-void Frogger::moveVehiclesLevelTwo()
-{
-    moveVehicle(car_row_one_two, 'M', 4);
-    moveVehicle(car_row_two_two, 'M', 3);
-    moveVehicle(car_row_three_two, 'F', 4);
-    moveVehicle(car_row_four_two, 'F', 3);      
-}
-
-void Frogger::moveLogsLevelOne()
-{
-    moveVehicle(row_one_log, 'S', 3);
-    moveVehicle(row_two_log, 'M', 2);
-    moveVehicle(row_three_log, 'S', 3);    
-}
-
-void Frogger::moveLogsLevelTwo()
-{
-    moveVehicle(level_row_one, 'F', 2);
-    moveVehicle(level_row_two, 'M', 2);
-    moveVehicle(level_row_two, 'F', 3);
-}
-
-void Frogger::moveBonusObjects()
-{
-    moveVehicle(bonus_row_one, 'F', 4);
-    moveVehicle(bonus_row_two, 'U', 3);
-    moveVehicle(bonus_row_four, 'U', 3); 
-    moveVehicle(bonus_row_seven, 'U', 2);
-    moveVehicle(bonus_row_eight, 'F', 3); 
-}
-/* ENGINE RUN */
-
-void Frogger::checkFrogOnWater()
-{
-    if(frog->y < water_level) // if the frog is past the safety lane
-    {
-       frogDie = true; // frog will die if not on turtle/log
-    } else {
-        frogDie = false;   
-    }
-}
-
-void Frogger::moveVehicle(Object *row, char c, int array_size)
-{
-    for(int i = 0; i < array_size; i++)
-    {
-        moveIndividualObject(&row[i], c);
-        checkCollison(row[i]); // check if the frog has crashed/on log
-        checkTurtleDrown();
-    }
-}
-
-void Frogger::checkTurtleDrown()
-{
-    // if the frog is on the row of the turtles and 
-    // turtles are under water, then frog is dead
-    if(frog->y == (48-(4*8)) 
-    && (turtle_state >= 3001)
-    && current_level == 2){
-        frog->reset(); // frog is dead
-    }
-}
-
-void Frogger::moveIndividualObject(Object *vehicle, char c){
-    switch(c)
-    {
-        case 'S':
-            vehicle->speedSlow(vehicle->object.dir);
-            break;
-        case 'M':
-            vehicle->speedMedium(vehicle->object.dir);
-            break;  
-        case 'F':
-            vehicle->speedFast(vehicle->object.dir);
-            break;
-        case 'U':
-            vehicle->speedUltra(vehicle->object.dir);
-            break;
-    }
-    checkOutOfBounds(vehicle);
-    checkFrogOutOfBounds(); 
-    graphics.showObj(vehicle, turtle_state);  // display to screen
-    updateTurtleState();
-}
-
-
-
-void Frogger::updateTurtleState()
-{
-    switch(turtle_state)
-    {
-        case 0 ... 1000:
-            turtle_state++;  
-            break;
-        case 1001 ... 2000:
-            turtle_state++;  
-            break;
-        case 2001 ... 3000:
-            turtle_state++;  
-            break;
-        case 3001 ... 4000:
-            turtle_state++;  
-            break;
-        case 4001 ... 5000: turtle_state++; break;
-        case 5001: turtle_state = 0; break;
-    }
-}
-/* ENGINE RUN */
-
-/* CHECKERS */
-void Frogger::checkOutOfBounds(Object *obj)
-{
-    if(obj->object.x > 84 + randCars()){
-        obj->object.x = -2;
-
-    } else if(obj->object.x < -8) {
-        obj->object.x = 84;
-    }
-}
-
-void Frogger::checkFrogOutOfBounds(){
-    if(frog->x > 84){
-        frog->reset(); // set the frog back to the start
-        graphics.printLoser();
-
-    } else if(frog->x < 0) {
-        frog->reset();
-        graphics.printLoser();
-    }
-}
-
-void Frogger::checkCollison(Object object)
-{
-    if(!(frog->up >= object.rectangle.bottom ||
-    (frog->right_side <= object.rectangle.left_side)  ||
-    (frog->down <= object.rectangle.up) ||
-    (frog->left_side >= object.rectangle.right_side))) {
-        moveFrogWithLog(object);
-        checkFrogAction(object); // check to do what do with frog based on height    
-    }
-}
-
-void Frogger::checkFrogReachedRiver()
-{
-    if(frog->y < water_level) {
-       frogDie = true; // frog can die if it touches water
-    } else {
-        frogDie = false;
-    }
-}
-
-void Frogger::checkFrogAction(Object log)
-{
-    if(frog->y < water_level) { // frog is in water zone
-        frogOnLog = true; // moving same speed as log
-        frogDie = false;
-
-    } else { // frog is on the road 
-        state_frog = 0; // facing upward
-        
-        frog->reset(); // crashed with car so reset
-        
-        frogOnLog = false;
-        frogDie = false;
-    }
-    
-    if(frog->y == (48 - (4*10)))
-    {
-        end_post = true;   
-    }
-}
-
-void Frogger::moveFrogWithLog(Object log)
-{
-    switch (log.object.dir)
-    {
-        case 1:
-            frog->x += log.speed; // move it right
-            break;
-                
-        case 2:
-            frog->x = frog->x - log.speed; // move it left
-            break;
-    }
-    
-    //printf("Log speed: %d", log.speed);
-}
-
-/* CHECKERS */
-
-/* X POS */
-void Frogger::setupLevelOneXPos()
-{
-    setupRowDistance(car_row_one_one, 20 , 3);
-    setupRowDistance(car_row_two_one, 25, 2);
-    setupRowDistance(car_row_three_one, 30, 3);
-    setupRowDistance(car_row_four_one, 25, 4);  
-}
-
-void Frogger::setLogLevelOneXPos()
-{
-    setupRowDistance(row_one_log, 20, 3);
-    setupRowDistance(row_two_log, 30, 2);
-    setupRowDistance(row_three_log, 25, 3);
-}
-
-void Frogger::setLogLevelTwoXPos()
-{
-    setupRowDistance(level_row_one, 20, 2);
-    setupRowDistance(level_row_two, 30, 2);
-    setupRowDistance(level_row_three, 25, 3);
-}
-
-void Frogger::setupLevelTwoXPos()
-{
-    setupRowDistance(car_row_one_two, 15, 4);
-    setupRowDistance(car_row_two_two, 20, 3);
-    setupRowDistance(car_row_three_two, 25, 4);
-    setupRowDistance(car_row_four_two, 25, 3);  
-}
-
-void Frogger::setupBonusXpos()
-{
-    setupRowDistance(bonus_row_one, 15, 4);
-    setupRowDistance(bonus_row_two, 20, 3);
-    setupRowDistance(bonus_row_four, 25, 3);
-
-    setupRowDistance(bonus_row_seven, 20, 2);
-    setupRowDistance(bonus_row_eight, 25, 3);
-}
-
-void Frogger::setupRowDistance(Object *objects, int dis, int array_size)
-{
-    for(int i = 0; i < array_size; i++)
-    {
-        setDistance(&objects[i], dis);
-        dis += dis; // ensure that each object has appropriate seperation        
-    }  
-}
-
-void Frogger::setDistance(Object *object, int dis)
-{
-    object->setSeperation(dis);
-    
-    //printf("Seperation set &d", object->object.dir);
-}
-/* X POS */
-
-/* ROW */
-
-void Frogger::setupLevelOneRow()
-{
-    setRowObjects(car_row_one_one, 2, 3);
-    setRowObjects(car_row_two_one, 3, 2);
-    setRowObjects(car_row_three_one, 4, 3);
-    setRowObjects(car_row_four_one, 5, 4);
-}
-
-void Frogger::setupLevelTwoRows()
-{
-    setRowObjects(car_row_one_two, 2, 4);
-    setRowObjects(car_row_two_two, 3, 3);
-    setRowObjects(car_row_three_two, 4, 4);
-    setRowObjects(car_row_four_two, 5, 3);
-}
-
-void Frogger::setLogLevelOneRow()
-{
-    setRowObjects(row_one_log, 7, 3);
-    setRowObjects(row_two_log, 8, 2);
-    setRowObjects(row_three_log, 9, 3);
-}
-
-void Frogger::setLogLevelTwoRow()
-{
-    setRowObjects(level_row_one, 7, 2);
-    setRowObjects(level_row_two, 8, 2);
-    setRowObjects(level_row_three, 9, 3);
-}
-
-void Frogger::setupBonusRows()
-{
-    setRowObjects(bonus_row_one, 2, 4);
-    setRowObjects(bonus_row_two, 3, 3);
-    setRowObjects(bonus_row_four, 4, 3);
-
-    setRowObjects(bonus_row_seven, 7, 2);
-    setRowObjects(bonus_row_eight, 9, 3);
-}
-
-void Frogger::setRowObjects(Object *objects, int row, int array_size)
-{
-    for(int i = 0; i < array_size; i++)
-    {
-        createRow(&objects[i], row);   
-        //printf("row number set &d", objects[i]->object.row); 
-    }  
-}
-
-void Frogger::createRow(Object *object, int row)
-{
-    object->setRow(row);  
-}
-/* ROW */
-
-/* SPRITES */
-void Frogger::setupLevelOneSprites()
-{
-    setSpriteObjects(car_row_one_one, 'X', 3);
-    setSpriteObjects(car_row_two_one, 'N', 2);
-    setSpriteObjects(car_row_three_one, 'B', 3);
-    setSpriteObjects(car_row_four_one, 'R', 4);  
-}
-
-void Frogger::setupLevelTwoSprites()
-{
-    setSpriteObjects(car_row_one_two, 'R', 4);
-    setSpriteObjects(car_row_two_two, 'L', 3);
-    setSpriteObjects(car_row_three_two, 'N', 4);
-    setSpriteObjects(car_row_four_two, 'X', 3);  
-}
-
-void Frogger::setLogLevelOneSprites()
-{
-    setSpriteObjects(row_one_log, 'G',3);
-    setSpriteObjects(row_two_log, 'M', 2);
-    setSpriteObjects(row_three_log, 'G', 3);
-}
-
-void Frogger::setLogLevelTwoSprite()
-{
-    setSpriteObjects(level_row_one, 'M', 2);
-    setSpriteObjects(level_row_two, 'T', 2);
-    setSpriteObjects(level_row_three, 'G', 3);
-}
-
-void Frogger::setupBonusSprites()
-{
-    setSpriteObjects(bonus_row_one, 'S', 4);
-    setSpriteObjects(bonus_row_two, 'S', 3);
-    setSpriteObjects(bonus_row_four, 'S', 3);
-
-    setSpriteObjects(bonus_row_seven, 'S', 2);
-    setSpriteObjects(bonus_row_eight, 'S', 3);
-}
-
-void Frogger::setSpriteObjects(Object *objects, char c, int array_size)
-{
-    for(int i = 0; i < array_size; i++)
-    {
-        setSprite(&objects[i], c);
-        //printf("sprite set &d", objects[i]->c);
-    }    
-}
-
-void Frogger::setSprite(Object *object, char c)
-{
-   object->setSprite(c);  
-}
-/* SPRITES */
-
-/* DIR */
-void Frogger::setupLevelOneDir()
-{
-    setDirObjects(car_row_one_one, 2, 3);
-    setDirObjects(car_row_two_one, 1, 2);
-    setDirObjects(car_row_three_one, 2, 3);
-    setDirObjects(car_row_four_one, 1, 4);  
-}
-
-void Frogger::setupLevelTwoDir()
-{
-    setDirObjects(car_row_one_two, 1, 4);
-    setDirObjects(car_row_two_two, 2, 3);
-    setDirObjects(car_row_three_two, 1, 4);
-    setDirObjects(car_row_four_two, 2, 3);  
-}
-
-void Frogger::setLogLevelOneDir()
-{
-    setDirObjects(row_one_log, 1, 3);
-    setDirObjects(row_two_log, 2, 2);
-    setDirObjects(row_three_log, 1, 3);
-}
-
-void Frogger::setLogLevelTwoDir()
-{
-    setDirObjects(level_row_one, 1, 2);
-    setDirObjects(level_row_two, 2, 2);
-    setDirObjects(level_row_three, 1, 3);
-}
-
-void Frogger::setupBonusTwoDir()
-{
-    setDirObjects(bonus_row_one, 2, 4);
-    setDirObjects(bonus_row_two, 1, 3);
-    setDirObjects(bonus_row_three, 2, 4);
-    setDirObjects(bonus_row_four, 1, 3);
-
-    setDirObjects(bonus_row_six, 1, 2);
-    setDirObjects(bonus_row_seven, 2, 2);
-    setDirObjects(bonus_row_eight, 1, 3); 
-}
-
-void Frogger::setDirObjects(Object *objects, int dir, int array_size)
-{
-   for(int i = 0; i < array_size; i++)
-    {
-        setDir(&objects[i], dir);
-        //printf("direction set &d", objects[i]->object.dir);
-    }    
-}
-
-void Frogger::setDir(Object *object, int dir)
-{
-    object->setDir(dir);  
-}
-/* DIR */
-
-// so the user does not predict when the next car is coming
-int Frogger::randCars()
-{
-    return (rand() % 4) + 1;
-}
+#include "Frogger.h"
+
+// level one initiailization has already been done
+Frogger::Frogger(Frog *frog, int grid, int w, int h)
+    :
+    pacer(FRAME_BUDGET_US),
+    menu_scene(this),
+    tutorial_scene(this),
+    play_scene(this),
+    bonus_scene(this)
+{
+    this->frog = frog; // one frog object per run
+    
+    current_level = 1;
+    input_count = 0;
+    joystick = 0;
+    initializeParams(w, h, grid); // initialize the software parameters
+    initializeEmbeddedSystem(); // initialize the hardware paramaters
+    initializeSession(); // seed the RNG, start recording or replaying input
+
+    intro.selection = 0;
+    intro.tutorial_screens = 0;
+
+    nextLevel = false;
+    
+    scenes.push(&menu_scene); // the levels are loaded when they're opened
+}
+
+GraphicEngine graphics;
+InputLog input_log; // button presses of this session, see RECORD_MODE/REPLAY_MODE
+
+void Frogger::initializeParams(int w, int h, int grid)
+{
+    // screen sizes
+    lcd_w = w; // width
+    lcd_h = h; // height
+    state_frog = 0;
+    end_post = false;
+    
+    frogDie = false;
+    frogOnLog = false;
+    next_goal = false;
+    
+    // grid values
+    grid = 4; // size of game grid system
+    grid_width = 22; // size of screen width in grid units
+}
+
+void Frogger::initializeEmbeddedSystem()
+{
+    //game setup
+    graphics.init(); // initialize the LCD object
+    graphics.contrast(); // set the contrast to 0.4
+    graphics.backLightOn(); // turn on the backlight
+
+    gamepad.init();  // initialize the actual embedded system 
+    audio.start(&gamepad); // mixes onto the gamepad's speaker from now on
+    
+    #ifdef PROFILER_MODE
+        Profiler::init(); // start the cycle counter
+    #endif
+}
+
+void Frogger::initializeSession()
+{
+    unsigned int seed = randomSeed();
+    
+    #ifdef REPLAY_MODE
+        seed = input_log.replay(replay_log, replay_log_size); // same seed and presses as the recording
+    #elif defined(RECORD_MODE)
+        input_log.record(seed);
+    #endif
+    
+    srand(seed);
+}
+
+// the gamepad reads the pots for it before its ADC sampler starts, reading
+// them from here would race the sampler's interrupt
+unsigned int Frogger::randomSeed()
+{
+    return gamepad.get_adc_seed();
+}
+
+// Gamepad events carry the same button bits as InputLog
+static_assert((int)INPUT_A == BUTTON_A && (int)INPUT_B == BUTTON_B && (int)INPUT_X == BUTTON_X
+              && (int)INPUT_Y == BUTTON_Y && (int)INPUT_START == BUTTON_START, "button bits differ");
+
+// button a joystick direction stands in for, 0 for the diagonals
+static int joystickMove(Direction direction)
+{
+    switch(direction) {
+        case E: return INPUT_A; // right
+        case N: return INPUT_X; // up the screen
+        case S: return INPUT_B;
+        case W: return INPUT_Y;
+        default: return 0;
+    }
+}
+
+void Frogger::readInput()
+{
+    input_count = 0;
+    
+    // gameplay moves repeat while held, menus and slides don't
+    bool moves_frog = scenes.top()->movesFrog();
+    gamepad.set_auto_repeat(moves_frog ? INPUT_A | INPUT_B | INPUT_X | INPUT_Y : 0);
+    
+    ButtonEvent event;
+    while(input_count < FRAME_INPUTS && gamepad.get_event(event)) {
+        if(event.button == INPUT_START) {
+            inputs[input_count++] = INPUT_START; // diagnostics, never recorded or replayed
+        } else if(!input_log.isReplaying()) {
+            inputs[input_count++] = event.button;
+            input_log.recordPressed(event.button);
+        } // the recording stands in for the gamepad
+    }
+    
+    // a push of the joystick moves the frog once, recorded as its button.
+    // The sampler has the reading already, so this doesn't wait for the ADC.
+    // Passing through a diagonal keeps the last push, so it doesn't move twice
+    Direction direction = moves_frog ? gamepad.get_direction() : CENTRE;
+    int move = joystickMove(direction);
+    if(move || direction == CENTRE) {
+        if(move && move != joystick && input_count < FRAME_INPUTS && !input_log.isReplaying()) {
+            inputs[input_count++] = move;
+            input_log.recordPressed(move);
+        }
+        joystick = move;
+    }
+    
+    int button;
+    while(input_count < FRAME_INPUTS && input_log.replayNext(button)) {
+        inputs[input_count++] = button;
+    }
+}
+
+bool Frogger::pressed(int button)
+{
+    for(int i = 0; i < input_count; i++) {
+        if(inputs[i] == button) {
+            inputs[i] = 0; // consumed
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Frogger::nextMove(int &button)
+{
+    for(int i = 0; i < input_count; i++) {
+        if(inputs[i] && inputs[i] != INPUT_START) {
+            button = inputs[i];
+            inputs[i] = 0; // consumed
+            return true;
+        }
+    }
+    return false;
+}
+
+void Frogger::loadLevel(int level)
+{
+    const LevelDef &def = levels[level];
+    
+    lanes.load(def);
+    graphics.lane_strips.load(lanes);
+    graphics.animator.reset(); // the turtles start on the surface
+    water_level = 48 - 4*(def.water_row - 1); // top of the safety lane below the water
+    setGoalPost(def.goal_x);
+}
+
+//main function that starts the game
+void Frogger::start()
+{     
+    pacer.start(); // first frame starts now
+    
+    //keep reading and processing user input
+    while(1) {
+        step();
+    } 
+}
+
+// one frame: read input, move everything, draw and send it to the lcd
+void Frogger::step()
+{
+    readInput(); // this frame's presses, from the gamepad or the replay
+    
+    // the menu and tutorial only draw and send a frame when they change
+    if(scenes.step()) {
+        graphics.refresh(); // sent in the background while the next frame is simulated
+    }
+    audio.update(); // effects that were waiting for a voice
+    
+    #ifdef LOGGER_MODE
+        printf("refresh bytes: %d\n", graphics.getRefreshBytes());
+        printf("frame work: %d us, overruns: %d\n", pacer.getWorkTime(), pacer.getOverruns());
+    #endif
+    
+    if(pressed(INPUT_START)) { // start prints the diagnostics over serial
+        #ifdef PROFILER_MODE
+            Profiler::dump(); // zone timings
+        #endif
+        #ifdef OVERDRAW_MODE
+            graphics.lcd.dumpOverdraw(); // pixel writes per frame, by call site
+        #endif
+        #ifdef RECORD_MODE
+            input_log.dump(); // ends the recording, ready to paste into ReplayLog.cpp
+        #endif
+    }
+    
+    input_log.endFrame();
+    pacer.endFrame(); // wait out the rest of the frame budget
+}
+
+void Frogger::displayIntro()
+{
+    graphics.introOne();
+    wait_ms(10);
+    graphics.refresh(); // refresh the lcd screen
+
+    graphics.refresh(); // refresh the lcd screen
+    graphics.clear();
+    graphics.introTwo();
+    wait_ms(3000);
+    graphics.refresh(); // refresh the lcd screen
+
+    graphics.refresh(); // refresh the lcd screen
+    graphics.clear();
+    wait_ms(5000);
+    graphics.refresh(); // refresh the lcd screen 
+}
+
+void Frogger::displayLevelIntro()
+{
+    graphics.clear();
+    graphics.newLevel1();
+    wait_ms(1000);
+    graphics.refresh(); // refresh the lcd screen
+
+    graphics.refresh(); // refresh the lcd screen
+    graphics.clear();
+    graphics.newLevel2();
+    wait_ms(1000);
+    graphics.refresh(); // refresh the lcd screen
+
+    graphics.refresh(); // refresh the lcd screen
+    graphics.clear();
+    wait_ms(1000);
+    graphics.refresh(); // refresh the lcd screen
+}
+
+void Frogger::run()
+{
+    PROFILE_ZONE(ZONE_RUN);
+    
+    //printf("FROG y position, %d", frog->y);
+    //printf("Display the current level, %d", current_level);   
+
+    graphics.animator.tick(); // one frame of every animation
+    drawBackGround();
+            
+    process_input(); // user controls the frog object
+       
+    actOnFrogPos();
+    checkProgression();
+    
+    resolveEvents(); // act on what happened to the frog this frame
+        
+    graphics.showFrog(frog->x.toInt(), frog->y, frog->width, frog->height, state_frog); // display current position of frog 
+}
+
+void Frogger::run_bonus()
+{
+    graphics.animator.tick();
+    //printf("FROG y position, %d", frog->y);
+    //printf("Display the current level, %d", current_level); 
+    
+    drawBackGround();    
+    process_input(); // user controls the frog object
+    actOnFrogBonus();
+    checkFrogInDeathZone();
+    checkProgression();
+    
+    resolveEvents();
+
+    graphics.showFrog(frog->x.toInt(), frog->y, frog->width, frog->height, state_frog); // display current position of frog 
+    graphics.drawVoidBackGround(); // over the lanes and the frog, the only place it's drawn
+}
+
+void Frogger::checkFrogInDeathZone()
+{
+    if(frog->x < 35 || frog->x > 55)
+    {
+        events.push(EVENT_DROWN); // fell into the void
+    }
+}
+
+void Frogger::checkProgression()
+{ 
+    if((frog->y == 48 - 4*11 || frog->y == 48 - 4*10)){
+        events.push(EVENT_LEVEL_COMPLETE);
+    }
+}
+
+void Frogger::completeLevel()
+{
+    frog->reset();
+    
+    if(current_level == LEVEL_BONUS) {
+        scenes.pop(); // back to the main menu
+    } else {
+        displayLevelIntro();
+        current_level++;
+        
+        if(current_level < LEVEL_COUNT) {
+            loadLevel(current_level);
+        }
+    }
+}
+
+void Frogger::resolveEvents()
+{
+    GameEvent event;
+    bool frog_reset = false; // the frog's events after it was reset are stale
+    
+    // resolving can push more events, they're handled in the same pass
+    while(events.pop(event))
+    {
+        if(frog_reset) {
+            continue;
+        }
+        
+        switch(event.type)
+        {
+            case EVENT_COLLISION: // nothing to do to the frog
+                break;
+            case EVENT_RIDE_LOG:
+                moveFrogWithLog(event.lane);
+                frogOnLog = true; // moving same speed as log
+                frogDie = false;
+                checkFrogOutOfBounds(); // the log might carry it off screen
+                break;
+            case EVENT_SQUASH:
+                audio.playEffect(&sound_squash);
+                state_frog = 0; // facing upward
+                frog->reset(); // crashed with car so reset
+                frogOnLog = false;
+                frogDie = false;
+                frog_reset = true;
+                break;
+            case EVENT_DROWN:
+                audio.playEffect(&sound_splash);
+                frog->reset();
+                frog_reset = true;
+                break;
+            case EVENT_OFF_SCREEN:
+                audio.playEffect(&sound_splash);
+                frog->reset(); // set the frog back to the start
+                graphics.printLoser();
+                frog_reset = true;
+                break;
+            case EVENT_REACH_GOAL:
+                end_post = true;
+                break;
+            case EVENT_LEVEL_COMPLETE:
+                audio.playEffect(&sound_level_complete);
+                completeLevel();
+                frog_reset = true;
+                break;
+        }
+    }
+}
+
+void Frogger::actOnFrogPos()
+{
+    if(frog->y >= water_level)
+    {
+        frogDie = false;
+        runCurrentLevel(); // add velocity to level vehicles and logs
+
+    } else {
+        frogDie = true;
+        runCurrentLevel(); // add velocity to level vehicles and logs
+            
+        bool riding = frogOnLog || events.contains(EVENT_RIDE_LOG);
+        
+        if((!riding) && (frog->y != 48 - 4*11 && frog->y != 48 - 4*10) && frog->x != 42){
+            events.push(EVENT_DROWN);
+        }
+    }
+}
+
+void Frogger::actOnFrogBonus()
+{
+    if(frog->y != 48 - 4*11 && (frog->y != 48 - 4*10)) {     
+        runCurrentLevel(); // the void is drawn over the lanes once the frog is on them too
+    } 
+}
+
+void Frogger::home()
+{
+    graphics.clear(); // clear the lcd screen 
+    graphics.getPointerPos(intro.selection); // draw the pointer at the selection
+    graphics.drawMenu(); // draw menu selections
+}
+
+bool Frogger::determineSelection()
+{
+    bool moved = false;
+    
+    if(intro.selection < 2 && pressed(INPUT_B)){
+        intro.selection++;
+        moved = true;
+
+    } else if(intro.selection > 0 && pressed(INPUT_X)){
+        intro.selection--;
+        moved = true;
+    }
+    
+    //printf("Current user selection,%d", intro.selection);
+
+    if(pressed(INPUT_A))
+    {
+        gotoPage(); // the page draws itself
+    }
+    return moved;
+}
+
+void Frogger::gotoPage()
+{
+    switch(intro.selection)
+    {
+        case 0:
+            scenes.replace(&play_scene); // there's no way back to the menu
+            break;
+        case 1:
+            scenes.push(&tutorial_scene);
+            break;
+        case 2: // bonus round
+            scenes.push(&bonus_scene);
+            break;
+    }
+}
+
+void Frogger::displayTutorial()
+{
+    graphics.clear(); // clear the lcd screen 
+    
+    switch(intro.tutorial_screens)
+    {
+        case 0:
+            graphics.drawTutor1();
+            break;
+        case 1:
+            graphics.drawTutor2();
+            break;
+        case 2:
+            graphics.drawTutor3();
+            break;
+    }
+}
+
+bool Frogger::gotoNextTutorialSlide()
+{
+    if(!pressed(INPUT_A)){
+        return false;
+    }
+    
+    intro.tutorial_screens++;
+    
+    if(intro.tutorial_screens > 2){
+        scenes.pop(); // back to the menu after the last slide
+        return false;
+    }
+    
+    //printf("Current tutorial screen, %d" intro.tutorial_screen);
+    return true;
+}
+
+void Frogger::drawBackGround()
+{
+    // past the last level there's no level to draw, the frog stays on the road and river
+    const TileMap *map = current_level < LEVEL_COUNT ? levels[current_level].background : &road_and_river_map;
+    graphics.drawBackground(*map, goal_post_xpos);
+}
+
+void Frogger::setGoalPost(int x)
+{
+    goal_post_xpos = x;
+}
+
+int Frogger::randEndPost()
+{
+    return (rand() % 80) + 12;      
+}
+
+
+
+void Frogger::process_input() {
+    int button;
+    
+    // every press since the last frame, in the order they were made
+    while(nextMove(button)) {
+        switch(button)
+        {
+            case INPUT_A:
+                state_frog = 1;
+                moveFrog(1,0); // move frog right
+                break;
+            case INPUT_X:
+                state_frog = 0;
+                moveFrog(0,-1);// move it down
+                break;
+            case INPUT_B:
+                state_frog = 3;
+                moveFrog(0,1); // move the frog up
+                break;
+            case INPUT_Y:
+                state_frog = 2;
+                moveFrog(-1,0); // move the frog left
+                break;
+        }
+        frogOnLog = false;
+        audio.playEffect(&sound_hop);
+    }
+}
+
+void Frogger::drawFrogStates()
+{
+    state_frog++;
+    graphics.showFrog(frog->x.toInt(), frog->y, frog->width, frog->height, state_frog); // display current position of frog
+    state_frog--;
+}
+
+//moves the frog around the grid
+void Frogger::moveFrog(int xWay, int yWay)
+{
+    //increment the left side of the chicken by a value of the grid size
+    frog->x += xWay * 4;
+    // printf("Current frog x, %d", frog->x);
+    
+    //increment the top side by a value of grid sizw
+    frog->y += yWay * 4;
+    // printf("Current frog y, %d", frog->y);
+
+    // update rect parameters
+    frog->left_side = frog->x;
+    frog->right_side = 6 + frog->x;
+    frog->up = frog->y;
+    frog->down = 4 + frog->y;
+    
+    //frog->test_frog();
+}
+
+/* ENGINE CALLS */
+void Frogger::runCurrentLevel()
+{
+    PROFILE_ZONE(ZONE_RUN_LEVEL);
+    
+    // nothing moves once the frog is past the last level
+    if(current_level < LEVEL_COUNT) {
+        runLanes();
+    }
+}
+/* ENGINE CALLS */
+
+/* ENGINE RUN */
+void Frogger::runLanes()
+{
+    lanes.update(); // move every object
+    
+    for(int lane = 0; lane < lanes.lanes; lane++)
+    {
+        graphics.showLane(lanes, lane);
+    }
+    
+    checkCollisions(); // check if the frog has crashed/on log
+    checkTurtleDrown();
+    checkFrogOutOfBounds(); 
+}
+
+void Frogger::checkCollisions()
+{
+    PROFILE_ZONE(ZONE_COLLISION);
+    
+    // broad phase, only the lanes the frog is in can touch it
+    unsigned int candidates = lanes.lanesBetween(frog->up.toInt(), frog->down.toInt());
+    
+    for(int lane = 0; candidates != 0; lane++, candidates >>= 1)
+    {
+        if(!(candidates & 1)) {
+            continue;
+        }
+        
+        int end = lanes.first[lane] + lanes.count[lane];
+        
+        for(int i = lanes.first[lane]; i < end; i++)
+        {
+            checkCollison(lane, i);
+        }
+    }
+}
+/* ENGINE RUN */
+
+void Frogger::checkFrogOnWater()
+{
+    if(frog->y < water_level) // if the frog is past the safety lane
+    {
+       frogDie = true; // frog will die if not on turtle/log
+    } else {
+        frogDie = false;   
+    }
+}
+
+void Frogger::checkTurtleDrown()
+{
+    // if the frog is on a lane of animated objects, turtles, and their
+    // current frame is under water, then frog is dead
+    unsigned int candidates = lanes.lanesBetween(frog->up.toInt(), frog->down.toInt());
+    
+    for(int lane = 0; candidates != 0; lane++, candidates >>= 1)
+    {
+        if(!(candidates & 1) || frog->y != lanes.y[lane]) {
+            continue;
+        }
+        
+        int anim = GraphicEngine::objectAnim(lanes.sprite[lane]);
+        if(anim >= 0 && (graphics.animator.frame(anim).flags & FRAME_SUBMERGED)) {
+            events.push(EVENT_DROWN); // frog is dead
+            return;
+        }
+    }
+}
+/* ENGINE RUN */
+
+/* CHECKERS */
+void Frogger::checkFrogOutOfBounds(){
+    if(frog->x > 84 || frog->x < 0){
+        events.push(EVENT_OFF_SCREEN);
+    }
+}
+
+void Frogger::checkCollison(int lane, int i)
+{
+    Fixed left_side = lanes.x[i];
+    Fixed right_side = left_side + lanes.width[lane];
+    int up = lanes.y[lane];
+    int bottom = up + lanes.height[lane];
+    
+    if(frog->up >= bottom ||
+    (frog->right_side <= left_side)  ||
+    (frog->down <= up) ||
+    (frog->left_side >= right_side)) {
+        return; // the rectangles don't overlap
+    }
+    
+    // narrow phase, the blank corners of the sprites don't count
+    const AnimFrame *frog_frame = graphics.frogFrame(state_frog, &graphics.animator);
+    const PackedSprite *object_pixels = graphics.objectSprite(lanes.sprite[lane], &graphics.animator);
+    
+    if(frog_frame && frog_frame->sprite && object_pixels 
+    && spritesTouch(*frog_frame->sprite, frog->x.toInt(), frog->y, *object_pixels, left_side.toInt(), up,
+                    frog_frame->flip, lanes.flip[lane])) {
+        events.push(EVENT_COLLISION, lane, i);
+        checkFrogAction(lane, i); // check to do what do with frog based on height    
+    }
+}
+
+void Frogger::checkFrogReachedRiver()
+{
+    if(frog->y < water_level) {
+       frogDie = true; // frog can die if it touches water
+    } else {
+        frogDie = false;
+    }
+}
+
+void Frogger::checkFrogAction(int lane, int i)
+{
+    if(frog->y < water_level) { // frog is in water zone
+        events.push(EVENT_RIDE_LOG, lane, i);
+    } else { // frog is on the road 
+        events.push(EVENT_SQUASH, lane, i);
+    }
+    
+    if(frog->y == (48 - (4*10)))
+    {
+        events.push(EVENT_REACH_GOAL, lane, i);
+    }
+}
+
+void Frogger::moveFrogWithLog(int lane)
+{
+    frog->x += lanes.velocity[lane]; // negative when the log moves left
+    frog->left_side = frog->x;
+    frog->right_side = 6 + frog->x;
+}
+
+/* CHECKERS */
@@ -0,0 +1,479 @@
+#include "HostBoard.h"
+
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <thread>
+
+// N5110 pins on the Gamepad board
+#define LCD_SCE PTB19
+#define LCD_DC  PTB18
+
+static int pins[PIN_COUNT];
+static InterruptIn *interrupts[PIN_COUNT];  // handler attached to each pin, if any
+static float analog[PIN_COUNT];
+static bool analog_written[PIN_COUNT];
+
+// every live Ticker and Timeout. Built on first use, as a global display
+// registers its SPI transfer Timeout before this file's statics are set up
+static std::vector<Ticker *> &live_tickers()
+{
+    static std::vector<Ticker *> tickers;
+    return tickers;
+}
+
+// model of the display controller
+static unsigned char lcd_ram[6][84];
+static int lcd_x;
+static int lcd_bank;
+static bool lcd_extended;
+static unsigned long lcd_data_bytes;
+
+static std::chrono::steady_clock::time_point const start_time = std::chrono::steady_clock::now();
+
+static bool virtual_time;
+static long long virtual_now;
+
+static long long real_time_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start_time).count();
+}
+
+long long host_time_us()
+{
+    return virtual_time ? virtual_now : real_time_us();
+}
+
+void host_set_virtual_time(bool enable)
+{
+    if (enable && !virtual_time) {
+        virtual_now = real_time_us();  // carry on from the real clock, timers stay in order
+    }
+    virtual_time = enable;
+}
+
+int host_pin_read(PinName pin)
+{
+    return (pin >= 0 && pin < PIN_COUNT) ? pins[pin] : 0;
+}
+
+void host_pin_write(PinName pin, int value)
+{
+    if (pin >= 0 && pin < PIN_COUNT) {
+        int const old = pins[pin];
+        pins[pin] = value;
+        if (interrupts[pin] && !old != !value) {
+            interrupts[pin]->edge(value);  // stands in for the pin interrupt
+        }
+    }
+}
+
+void host_press(PinName pin)
+{
+    host_pin_write(pin, 0);  // buttons pull the pin low
+    host_pin_write(pin, 1);
+}
+
+void host_analog_write(PinName pin, float value)
+{
+    if (pin >= 0 && pin < PIN_COUNT) {
+        analog[pin] = value;
+        analog_written[pin] = true;
+    }
+}
+
+float host_analog_read(PinName pin)
+{
+    if (pin >= 0 && pin < PIN_COUNT && analog_written[pin]) {
+        return analog[pin];
+    }
+    return 0.5f;  // joystick centred, pots half way
+}
+
+void host_lcd_byte(int value)
+{
+    if (host_pin_read(LCD_SCE)) {
+        return;  // chip not selected
+    }
+
+    if (host_pin_read(LCD_DC)) {  // data - horizontal addressing
+        lcd_ram[lcd_bank][lcd_x] = value;
+        lcd_data_bytes++;
+        if (++lcd_x == 84) {
+            lcd_x = 0;
+            lcd_bank = (lcd_bank + 1) % 6;
+        }
+    } else if ((value & 0xF8) == 0x20) {  // function set
+        lcd_extended = value & 0x01;
+    } else if (!lcd_extended && (value & 0x80)) {  // set X address
+        lcd_x = (value & 0x7F) % 84;
+    } else if (!lcd_extended && (value & 0xF8) == 0x40) {  // set Y address
+        lcd_bank = (value & 0x07) % 6;
+    }
+}
+
+int host_lcd_pixel(int x, int y)
+{
+    return (lcd_ram[y / 8][x] >> (y % 8)) & 1;
+}
+
+unsigned long host_lcd_data_bytes()
+{
+    return lcd_data_bytes;
+}
+
+void host_lcd_print()
+{
+    printf("+");
+    for (int x = 0; x < 84; x++) {
+        printf("-");
+    }
+    printf("+\n");
+    for (int y = 0; y < 48; y++) {
+        printf("|");
+        for (int x = 0; x < 84; x++) {
+            printf("%c", host_lcd_pixel(x, y) ? '#' : ' ');
+        }
+        printf("|\n");
+    }
+    printf("+");
+    for (int x = 0; x < 84; x++) {
+        printf("-");
+    }
+    printf("+\n");
+}
+
+// spin rather than sleep so short delays are accurate
+static void spin_until(long long t)
+{
+    while (real_time_us() < t) {
+    }
+}
+
+// move the clock to time t, sleeping for long waits on the real clock
+static void clock_until(long long t)
+{
+    if (virtual_time) {
+        virtual_now = std::max(virtual_now, t);
+    } else if (t - real_time_us() < 2000) {
+        spin_until(t);
+    } else {
+        std::this_thread::sleep_until(start_time + std::chrono::microseconds(t));
+    }
+}
+
+// earliest Ticker or Timeout due by time t
+static Ticker *next_due(long long t)
+{
+    std::vector<Ticker *> const &tickers = live_tickers();
+    Ticker *next = NULL;
+    for (size_t i = 0; i < tickers.size(); i++) {
+        long long const due = tickers[i]->due();
+        if (due >= 0 && due <= t && (!next || due < next->due())) {
+            next = tickers[i];
+        }
+    }
+    return next;
+}
+
+void host_advance_us(long long us)
+{
+    long long const end = host_time_us() + us;
+
+    // handlers can attach or detach others, so look again after each one
+    while (Ticker *ticker = next_due(end)) {
+        long long const due = ticker->due();
+        clock_until(due);
+        ticker->fire(due);
+    }
+    clock_until(end);
+}
+
+void wait_us(int us)
+{
+    host_advance_us(us);
+}
+
+void wait_ms(int ms)
+{
+    host_advance_us(ms * 1000LL);
+}
+
+void wait(float s)
+{
+    host_advance_us(static_cast<long long>(s * 1e6f));
+}
+
+namespace mbed
+{
+
+DigitalOut::DigitalOut(PinName pin)
+    : _pin(pin)
+{}
+
+void DigitalOut::write(int value)
+{
+    host_pin_write(_pin, value);
+}
+
+int DigitalOut::read()
+{
+    return host_pin_read(_pin);
+}
+
+InterruptIn::InterruptIn(PinName pin)
+    : _pin(pin)
+{
+    if (pin >= 0 && pin < PIN_COUNT) {
+        interrupts[pin] = this;
+    }
+}
+
+InterruptIn::~InterruptIn()
+{
+    if (_pin >= 0 && _pin < PIN_COUNT && interrupts[_pin] == this) {
+        interrupts[_pin] = NULL;
+    }
+}
+
+int InterruptIn::read()
+{
+    return host_pin_read(_pin);
+}
+
+void InterruptIn::mode(PinMode pull)
+{
+    if (_pin >= 0 && _pin < PIN_COUNT && pull != PullNone) {
+        pins[_pin] = pull == PullUp;  // idle level, not an edge
+    }
+}
+
+void InterruptIn::rise(Callback<void()> func)
+{
+    _rise = func;
+}
+
+void InterruptIn::fall(Callback<void()> func)
+{
+    _fall = func;
+}
+
+void InterruptIn::edge(int value)
+{
+    if (value && _rise) {
+        _rise.call();
+    } else if (!value && _fall) {
+        _fall.call();
+    }
+}
+
+AnalogIn::AnalogIn(PinName pin)
+    : _pin(pin)
+{}
+
+float AnalogIn::read()
+{
+    return host_analog_read(_pin);
+}
+
+unsigned short AnalogIn::read_u16()
+{
+    return static_cast<unsigned short>(host_analog_read(_pin) * 65535.0f);
+}
+
+AnalogOut::AnalogOut(PinName pin)
+    : _pin(pin)
+{}
+
+void AnalogOut::write(float value)
+{
+    host_analog_write(_pin, value);
+}
+
+void AnalogOut::write_u16(unsigned short value)
+{
+    host_analog_write(_pin, value / 65535.0f);
+}
+
+float AnalogOut::read()
+{
+    return host_analog_read(_pin);
+}
+
+PwmOut::PwmOut(PinName pin)
+    : _pin(pin)
+{}
+
+void PwmOut::write(float value)
+{
+    host_analog_write(_pin, value);  // duty cycle
+}
+
+float PwmOut::read()
+{
+    return host_analog_read(_pin);
+}
+
+void PwmOut::period(float s)
+{}
+
+void PwmOut::pulsewidth(float s)
+{}
+
+Timer::Timer()
+    : _running(false),
+      _start(0),
+      _time(0)
+{}
+
+void Timer::start()
+{
+    if (!_running) {
+        _start = host_time_us();
+        _running = true;
+    }
+}
+
+void Timer::stop()
+{
+    _time = elapsed();
+    _running = false;
+}
+
+void Timer::reset()
+{
+    _start = host_time_us();
+    _time = 0;
+}
+
+long long Timer::elapsed()
+{
+    return _running ? _time + host_time_us() - _start : _time;
+}
+
+float Timer::read()
+{
+    return elapsed() / 1e6f;
+}
+
+int Timer::read_ms()
+{
+    return static_cast<int>(elapsed() / 1000);
+}
+
+int Timer::read_us()
+{
+    return static_cast<int>(elapsed());
+}
+
+Ticker::Ticker()
+    : _interval(0),
+      _due(-1),
+      _repeat(true)
+{
+    live_tickers().push_back(this);
+}
+
+Ticker::~Ticker()
+{
+    std::vector<Ticker *> &tickers = live_tickers();
+    tickers.erase(std::remove(tickers.begin(), tickers.end(), this), tickers.end());
+}
+
+void Ticker::attach(Callback<void()> func, float s)
+{
+    attach_us(func, static_cast<long long>(s * 1e6f));
+}
+
+void Ticker::attach_us(Callback<void()> func, long long us)
+{
+    _func = func;
+    _interval = std::max(us, 1LL);  // a zero period would never let the clock move on
+    _due = host_time_us() + _interval;
+}
+
+void Ticker::detach()
+{
+    _due = -1;
+}
+
+bool Ticker::fire(long long now)
+{
+    if (_due < 0 || _due > now) {
+        return false;
+    }
+    _due = _repeat ? _due + _interval : -1;
+    if (_func) {
+        _func.call();
+    }
+    return true;
+}
+
+long long Ticker::due() const
+{
+    return _due;
+}
+
+Timeout::Timeout()
+{
+    _repeat = false;
+}
+
+SPI::SPI(PinName mosi, PinName miso, PinName sclk)
+    : _hz(1000000),
+      _bus_free(0),
+      _in_event(false),
+      _event(0)
+{}
+
+SPI::~SPI()
+{}
+
+void SPI::format(int bits, int mode)
+{}
+
+void SPI::frequency(int hz)
+{
+    _hz = hz;
+}
+
+int SPI::write(int value)
+{
+    long long const t = host_time_us();
+    host_lcd_byte(value);
+    clock_until(t + 8000000LL / _hz);  // one byte at the bus clock
+    return 0;
+}
+
+int SPI::startTransfer(const unsigned char *tx, int length,
+                       const event_callback_t &callback, int event)
+{
+    // the display model takes the bytes now, only the time they take is modelled.
+    // One started from the completion of the last follows on from its end, even
+    // if the wait call that ran the completion got there later
+    long long const now = host_time_us();
+    long long const start = _in_event ? _bus_free : std::max(now, _bus_free);
+    for (int i = 0; i < length; i++) {
+        host_lcd_byte(tx[i]);
+    }
+    _bus_free = start + 8000000LL * length / _hz;
+
+    _callback = callback;
+    _event = event;
+    _done.attach_us(mbed::callback(this, &SPI::transferDone), _bus_free - now);
+    return 0;
+}
+
+// plays the part of the SPI interrupt, the event callback may queue the next transfer
+void SPI::transferDone()
+{
+    event_callback_t const done = _callback;
+    _in_event = true;
+    if (done) {
+        done.call(_event);
+    }
+    _in_event = false;
+}
+
+} // namespace mbed
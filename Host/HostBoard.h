@@ -0,0 +1,64 @@
+#ifndef HOSTBOARD_H
+#define HOSTBOARD_H
+
+#include "mbed.h"
+
+/** Host board model
+ *
+ * @brief State behind the mbed stand-ins: the pin and analog tables, the clock,
+ * @brief and a model of the N5110's controller that decodes the bytes sent over
+ * @brief SPI into its own display RAM, so a test can check what the panel shows.
+ */
+
+/** @brief level last written to a pin */
+int host_pin_read(PinName pin);
+
+/** @brief set the level of a pin */
+void host_pin_write(PinName pin, int value);
+
+/** @brief press and release a button, the InterruptIn on the pin sees a fall then a rise */
+void host_press(PinName pin);
+
+/** @brief set the level an AnalogIn reads
+ *  @param value - 0.0 to 1.0
+ */
+void host_analog_write(PinName pin, float value);
+
+/** @brief level last written to an analog pin, 0.5 if never written */
+float host_analog_read(PinName pin);
+
+/** @brief feed one byte from the SPI bus to the display model
+ *  @param value - byte clocked out on MOSI
+ */
+void host_lcd_byte(int value);
+
+/** @brief pixel in the display model's RAM
+ *  @param x - column (0 to 83)
+ *  @param y - row (0 to 47)
+ *  @returns 1 if the pixel is set
+ */
+int host_lcd_pixel(int x, int y);
+
+/** @brief number of data bytes the display model has received */
+unsigned long host_lcd_data_bytes();
+
+/** @brief print the display model's RAM as text, one character per pixel */
+void host_lcd_print();
+
+/** @brief microseconds since the program started, or of virtual time */
+long long host_time_us();
+
+/** @brief switch the clock to virtual time. The wait calls then return at once
+ *  @brief and move the clock on instead, SPI::write() moves it on by the byte
+ *  @brief time and SPI::transfer() completes before it returns, so the game runs
+ *  @brief as fast as the host can go while timers still see board time.
+ *  @param enable - true for virtual time, false (the default) for real time
+ */
+void host_set_virtual_time(bool enable);
+
+/** @brief move the clock on, running Ticker and Timeout handlers as they fall due.
+ *  @brief Sleeps or spins for the time unless the clock is virtual.
+ */
+void host_advance_us(long long us);
+
+#endif
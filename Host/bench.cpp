@@ -0,0 +1,185 @@
+#include "mbed.h"
+#include "HostBoard.h"
+#include "Frogger.h"
+#include "Vehicle.h"
+#include "Tiles.h"
+
+#include <chrono>
+
+/* Fixed workloads for the rendering and simulation primitives, printed as JSON:
+ *
+ *     make bench > bench.json
+ *
+ * ns_per_op is the best of several timed runs, so noise from the rest of the
+ * machine only ever makes it look slower. ops_per_frame is how many of the op
+ * would fit in one FRAME_BUDGET_US frame at that speed. The display is on the
+ * stand-in SPI under virtual time, so refresh measures the driver, not the bus.
+ */
+
+#define RUNS 5
+#define MIN_RUN_NS 20000000LL // each run lasts at least 20ms
+
+static long long now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool first_result = true;
+
+// times op() and prints one JSON result
+template <typename Op>
+static void bench(const char *name, Op op)
+{
+    // double the batch until a run is long enough to time
+    long long batch = 1;
+    while (true) {
+        long long const t = now_ns();
+        for (long long i = 0; i < batch; i++) {
+            op();
+        }
+        if (now_ns() - t >= MIN_RUN_NS) {
+            break;
+        }
+        batch *= 2;
+    }
+
+    double best = 1e30;
+    for (int run = 0; run < RUNS; run++) {
+        long long const t = now_ns();
+        for (long long i = 0; i < batch; i++) {
+            op();
+        }
+        double const ns = (double)(now_ns() - t) / batch;
+        if (ns < best) {
+            best = ns;
+        }
+    }
+
+    printf("%s\n    {\"name\": \"%s\", \"ns_per_op\": %.1f, \"ops_per_frame\": %.0f}",
+           first_result ? "" : ",", name, best, FRAME_BUDGET_US * 1000.0 / best);
+    first_result = false;
+}
+
+int main()
+{
+    host_set_virtual_time(true);
+
+    printf("{\n  \"frame_budget_us\": %d,\n  \"benchmarks\": [", FRAME_BUDGET_US);
+
+    // N5110 primitives
+    N5110 lcd;
+    lcd.init();
+    lcd.setDirtyTracking(true);
+
+    static int bus_table[4][16];  // drawSprite() takes a non-const table
+    memcpy(bus_table, bus, sizeof(bus_table));
+
+    bench("N5110::drawSprite/aligned", [&] { lcd.drawSprite(20, 16, 4, 16, (int *)bus_table); });
+    bench("N5110::drawSprite/unaligned", [&] { lcd.drawSprite(20, 19, 4, 16, (int *)bus_table); });
+    bench("N5110::drawPackedSprite/aligned", [&] { lcd.drawPackedSprite(20, 16, bus_sprite); });
+    bench("N5110::drawPackedSprite/unaligned", [&] { lcd.drawPackedSprite(20, 19, bus_sprite); });
+    bench("N5110::drawPackedSprite/flip_x", [&] { lcd.drawPackedSprite(20, 19, bus_sprite, FLIP_X); });
+    bench("N5110::drawPackedSprite/flip_xy", [&] { lcd.drawPackedSprite(20, 19, bus_sprite, FLIP_X | FLIP_Y); });
+    bench("N5110::drawRect/void_background", [&] {
+        lcd.drawRect(0, 0, 35, 48, FILL_BLACK);  // as drawVoidBackGround()
+        lcd.drawRect(55, 0, 35, 48, FILL_BLACK);
+    });
+    bench("N5110::drawTileMap/road_and_river", [&] { lcd.drawTileMap(road_and_river_map); });
+    bench("N5110::printString", [&] { lcd.printString("Tutorial: (A) ", 0, 0); });
+
+    // each refresh first lets the modelled clock run past the last transfer,
+    // a frame as in the game, so it doesn't spin waiting for the bus
+    int frame = 0;
+    bench("N5110::refresh/full", [&] {
+        wait_us(FRAME_BUDGET_US);
+        lcd.setDirtyTracking(false);
+        lcd.refresh();
+    });
+    bench("N5110::refresh/dirty_sprite", [&] {
+        wait_us(FRAME_BUDGET_US);
+        lcd.setDirtyTracking(true);
+        lcd.drawPackedSprite(frame++ % 70, 19, bus_sprite);
+        lcd.refresh();
+    });
+
+    // narrow phase of collision, frog over the end of a log
+    volatile bool touched;  // keeps the result from being optimised away
+    bench("spritesTouch/blank_corner", [&] {
+        touched = spritesTouch(frog_state_up_sprite, -5, 0, log_big_sprite, 0, 0);
+    });
+    bench("spritesTouch/hit", [&] {
+        touched = spritesTouch(frog_state_up_sprite, 7, 1, log_big_sprite, 0, 0);
+    });
+
+    // Object movement
+    Object object;
+    object.setDir(1);
+    bench("Object::speedSlow", [&] { object.speedSlow(1); });
+    bench("Object::speedMedium", [&] { object.speedMedium(1); });
+    bench("Object::speedFast", [&] { object.speedFast(1); });
+    bench("Object::speedUltra", [&] { object.speedUltra(1); });
+
+    // joystick pushed north east, the blocking float path against the sampler
+    Gamepad gamepad;
+    gamepad.init();
+    host_analog_write(PTB10, 0.9f);
+    host_analog_write(PTB11, 0.1f);
+    host_advance_us(GAMEPAD_ADC_US * 16);  // the filter settles on the push
+    volatile float angle;
+    volatile int direction;
+    bench("Gamepad::get_polar", [&] { angle = gamepad.get_polar().angle; });
+    bench("Gamepad::get_direction", [&] { direction = gamepad.get_direction(); });
+    host_analog_write(PTB10, 0.5f);  // centred again for the game
+    host_analog_write(PTB11, 0.5f);
+
+    // audio mixer interrupt, nothing playing and every voice playing
+    AudioEngine audio;
+    volatile int sample;
+    bench("AudioEngine::mix/silent", [&] { sample = audio.mix(); });
+    audio.playMusic(&theme_music);
+    bench("AudioEngine::mix/four_voices", [&] {
+        if (!audio.isPlaying()) {
+            audio.playEffect(&sound_splash);  // start the effects again as they end
+            audio.playEffect(&sound_squash);
+            audio.playEffect(&sound_level_complete);
+        }
+        sample = audio.mix();
+    });
+
+    // game
+    Frog frog(84/2 - 6/2, 48 - 4, 6);  // as in main.cpp
+    Frogger game(&frog, 4, 84, 48);
+    game.scenes.replace(&game.play_scene);  // loads level one
+
+    // first car of the first lane, the lane above the frog, no overlap
+    bench("Frogger::checkCollison/miss", [&] { game.checkCollison(0, game.lanes.first[0]); });
+    bench("Frogger::checkCollisions/start_lane", [&] { game.checkCollisions(); });
+    bench("LaneTable::update/level_one", [&] { game.lanes.update(); });
+    static LaneStrips strips;  // the lane strips of level one
+    strips.load(game.lanes);
+    bench("LaneStrips::draw/four_cars", [&] { strips.draw(lcd, game.lanes, 3, &right_racer_sprite, FLIP_NONE); });
+
+    game.current_level = 1;
+    game.loadLevel(LEVEL_ONE);
+    bench("Frogger::run/level_one", [&] {
+        game.run();
+        frog.reset();  // stay on the start lane
+    });
+
+    game.current_level = 2;
+    game.loadLevel(LEVEL_TWO);
+    bench("Frogger::run/level_two", [&] {
+        game.run();
+        frog.reset();
+    });
+
+    game.scenes.replace(&game.bonus_scene);  // loads the bonus round
+    bench("Frogger::run_bonus/bonus_round", [&] {
+        game.run_bonus();
+        frog.reset();
+    });
+
+    printf("\n  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include "mbed.h"
+#include "HostBoard.h"
+#include "Frogger.h"
+
+#include <chrono>
+
+/* Runs the whole game headless on Linux. The clock is virtual, so the frame
+ * pacer and every wait_ms() return at once and the game runs as fast as the
+ * host can simulate it. Buttons are pressed from a script:
+ *
+ *     bin/frogger [frames] [script]
+ *
+ * A script line is "<frame> <A|B|X|Y|START>". Without one, A picks Play from
+ * the menu and the frog then hops around on its own. The run fails if the frog
+ * ever leaves the screen, the figures of a frog-less run would mean nothing, and
+ * stops early once both levels are completed.
+ */
+
+#define DEFAULT_FRAMES 20000
+
+#ifdef OVERDRAW_MODE
+extern GraphicEngine graphics; // the game draws through it, see Frogger.cpp
+#endif
+
+// Gamepad (Rev 2.1) button pins
+static PinName buttonPin(const char *name)
+{
+    if (!strcmp(name, "A")) return PTC7;
+    if (!strcmp(name, "B")) return PTC9;
+    if (!strcmp(name, "X")) return PTC5;
+    if (!strcmp(name, "Y")) return PTC0;
+    if (!strcmp(name, "START")) return PTC8;
+    return NC;
+}
+
+struct ScriptPress
+{
+    int frame;
+    PinName pin;
+};
+
+static int loadScript(const char *path, ScriptPress *presses, int max)
+{
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "can't open %s\n", path);
+        exit(1);
+    }
+
+    int count = 0;
+    int frame;
+    char name[16];
+    while (count < max && fscanf(file, "%d %15s", &frame, name) == 2) {
+        PinName const pin = buttonPin(name);
+        if (pin == NC) {
+            fprintf(stderr, "%s: unknown button %s\n", path, name);
+            exit(1);
+        }
+        presses[count].frame = frame;
+        presses[count].pin = pin;
+        count++;
+    }
+    fclose(file);
+    return count;
+}
+
+// A on the menu, then a hop every 5 frames: mostly up (X), with some sideways.
+// No hops down (B), the frog starts on the bottom row and would hop off it
+static int defaultScript(int frames, ScriptPress *presses, int max)
+{
+    static const char *const hops[] = {"X", "X", "Y", "X", "A", "X", "X", "Y"};
+    int count = 0;
+
+    presses[count].frame = 1;
+    presses[count].pin = buttonPin("A");
+    count++;
+    for (int frame = 5; frame < frames && count < max; frame += 5) {
+        presses[count].frame = frame;
+        presses[count].pin = buttonPin(hops[(frame / 5) % 8]);
+        count++;
+    }
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    int const frames = argc > 1 ? atoi(argv[1]) : DEFAULT_FRAMES;
+
+    static ScriptPress presses[100000];
+    int const press_count = argc > 2 ? loadScript(argv[2], presses, 100000)
+                                     : defaultScript(frames, presses, 100000);
+
+    host_set_virtual_time(true);
+
+    Frog frog(84/2 - 6/2, 48 - 4, 6);  // as in main.cpp
+    Frogger game(&frog, 4, 84, 48);
+    game.displayIntro();
+    #ifdef OVERDRAW_MODE
+        graphics.lcd.resetOverdraw(); // only the frames of the game, not the intro
+    #endif
+
+    long long const game_start = host_time_us();
+    std::chrono::steady_clock::time_point const wall_start = std::chrono::steady_clock::now();
+    unsigned long const bytes_start = host_lcd_data_bytes();
+
+    game.pacer.start();
+    int next = 0;
+    int frame = 0;
+    for (; frame < frames; frame++) {
+        while (next < press_count && presses[next].frame <= frame) {
+            host_press(presses[next].pin);
+            next++;
+        }
+        game.step();
+        
+        if (frog.y < 0 || frog.y + frog.height > 48 || frog.x < 0 || frog.x >= 84) {
+            fprintf(stderr, "frame %d: the frog left the screen at %d,%d\n", frame, frog.x.toInt(), frog.y);
+            return 1;
+        }
+        if (game.current_level >= LEVEL_COUNT) {
+            frame++;
+            break;  // both levels done, nothing moves from here on
+        }
+    }
+
+    double const wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    double const game_s = (host_time_us() - game_start) / 1e6;
+
+    if (getenv("FROGGER_SHOW")) {
+        host_lcd_print();  // last frame on the display model
+    }
+
+    printf("frames           %d%s\n", frame, frame < frames ? "  (the game was completed)" : "");
+    printf("host time        %.3f s  (%.0f simulated frames/s)\n", wall_s, frame / wall_s);
+    printf("game time        %.1f s  (%.2f frames/s on the board)\n", game_s, frame / game_s);
+    printf("frame overruns   %d\n", game.pacer.getOverruns());
+    printf("lcd bytes/frame  %.1f\n", (double)(host_lcd_data_bytes() - bytes_start) / frame);
+    #ifdef OVERDRAW_MODE
+        graphics.lcd.dumpOverdraw();
+    #endif
+    return 0;
+}
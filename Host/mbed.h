@@ -0,0 +1,248 @@
+#ifndef MBED_H
+#define MBED_H
+
+/** Host stand-in for mbed
+ *
+ * @brief Just enough of the mbed API for the game to build and run on Linux.
+ * @brief Pins and analog inputs are kept in tables, and the SPI bus is timed at
+ * @brief the configured clock rate and feeds an in-memory model of the N5110
+ * @brief (see HostBoard.h), so refresh timing can be measured without the board.
+ * @brief The host has no interrupts: button edges call InterruptIn handlers as
+ * @brief the pin is written, and Ticker/Timeout handlers run from the wait calls.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <stdint.h>
+
+#include <functional>
+
+// the stand-in SPI supports the asynchronous transfer API
+#ifndef DEVICE_SPI_ASYNCH
+#define DEVICE_SPI_ASYNCH 1
+#endif
+#define SPI_EVENT_COMPLETE (1 << 3)
+
+/// Pins used by the Gamepad (Rev 2.1) board
+typedef enum {
+    PTA1, PTA2,
+    PTB2, PTB3, PTB10, PTB11, PTB18, PTB19, PTB23,
+    PTC0, PTC1, PTC2, PTC3, PTC5, PTC7, PTC8, PTC9, PTC10, PTC11,
+    PTD1, PTD2,
+    DAC0_OUT,
+    PIN_COUNT,
+    NC = -1
+} PinName;
+
+typedef enum {
+    PullNone,
+    PullUp,
+    PullDown
+} PinMode;
+
+namespace mbed
+{
+
+template <typename F>
+class Callback;
+
+/// Callback to a function or member function, like mbed::Callback
+template <typename R, typename... A>
+class Callback<R(A...)>
+{
+public:
+    Callback() {}
+    Callback(R (*func)(A...)) : _func(func) {}
+
+    template <typename T>
+    Callback(T *obj, R (T::*method)(A...))
+        : _func([obj, method](A... args) { return (obj->*method)(args...); }) {}
+
+    R call(A... args) const { return _func(args...); }
+    R operator()(A... args) const { return _func(args...); }
+    operator bool() const { return static_cast<bool>(_func); }
+
+private:
+    std::function<R(A...)> _func;
+};
+
+template <typename T, typename R, typename... A>
+Callback<R(A...)> callback(T *obj, R (T::*method)(A...))
+{
+    return Callback<R(A...)>(obj, method);
+}
+
+typedef Callback<void(int)> event_callback_t;
+
+class DigitalOut
+{
+public:
+    DigitalOut(PinName pin);
+    void write(int value);
+    int read();
+
+private:
+    PinName _pin;
+};
+
+/** Input with edge handlers, called from host_pin_write() as the level changes */
+class InterruptIn
+{
+public:
+    InterruptIn(PinName pin);
+    ~InterruptIn();
+
+    int read();
+    void mode(PinMode pull);
+    void rise(Callback<void()> func);
+    void fall(Callback<void()> func);
+
+    /// called by the board model when the pin changes level
+    void edge(int value);
+
+private:
+    PinName _pin;
+    Callback<void()> _rise;
+    Callback<void()> _fall;
+};
+
+/** Reads the level set with host_analog_write(), 0.5 (centred) by default */
+class AnalogIn
+{
+public:
+    AnalogIn(PinName pin);
+    float read();
+    unsigned short read_u16();
+
+private:
+    PinName _pin;
+};
+
+class AnalogOut
+{
+public:
+    AnalogOut(PinName pin);
+    void write(float value);
+    void write_u16(unsigned short value);
+    float read();
+
+private:
+    PinName _pin;
+};
+
+class PwmOut
+{
+public:
+    PwmOut(PinName pin);
+    void write(float value);
+    float read();
+    void period(float s);
+    void pulsewidth(float s);
+
+private:
+    PinName _pin;
+};
+
+/** Microsecond timer on the host clock (see host_set_virtual_time()) */
+class Timer
+{
+public:
+    Timer();
+    void start();
+    void stop();
+    void reset();
+    float read();
+    int read_ms();
+    int read_us();
+
+private:
+    long long elapsed();
+
+    bool _running;
+    long long _start;
+    long long _time;
+};
+
+/** Repeating handler, run from wait_us/wait_ms/wait once it is due */
+class Ticker
+{
+public:
+    Ticker();
+    virtual ~Ticker();
+
+    void attach(Callback<void()> func, float s);
+    void attach_us(Callback<void()> func, long long us);
+    void detach();
+
+    /// runs the handler if it is due at time now, true if it ran
+    bool fire(long long now);
+    /// time the handler is next due, -1 if detached
+    long long due() const;
+
+protected:
+    Callback<void()> _func;
+    long long _interval;
+    long long _due;
+    bool _repeat;
+};
+
+/** One-shot handler, run from the wait calls once it is due */
+class Timeout : public Ticker
+{
+public:
+    Timeout();
+};
+
+/** SPI master stand-in
+ *
+ * write() blocks for one byte time at the configured frequency. transfer() puts
+ * the buffer on a modelled bus: it takes the byte time of every byte, commands
+ * and data alike, on the host clock from when the bus is free, and the event
+ * callback runs from the wait calls once the clock gets there, like an interrupt
+ * driven transfer on the board. A transfer started from that callback follows
+ * straight on, so a chain of them costs only its bytes.
+ */
+class SPI
+{
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk);
+    ~SPI();
+
+    void format(int bits, int mode = 0);
+    void frequency(int hz = 1000000);
+    int write(int value);
+
+    template <typename Type>
+    int transfer(const Type *tx_buffer, int tx_length, Type *rx_buffer, int rx_length,
+                 const event_callback_t &callback, int event = SPI_EVENT_COMPLETE)
+    {
+        return startTransfer(reinterpret_cast<const unsigned char *>(tx_buffer),
+                             tx_length * sizeof(Type), callback, event);
+    }
+
+private:
+    int startTransfer(const unsigned char *tx, int length,
+                      const event_callback_t &callback, int event);
+    void transferDone();
+
+    int _hz;
+
+    // transfer on the bus, it completes when _done fires
+    Timeout _done;
+    long long _bus_free;  // host time the last transfer ends
+    bool _in_event;  // running the completion callback
+    event_callback_t _callback;
+    int _event;
+};
+
+} // namespace mbed
+
+using namespace mbed;
+
+void wait_ms(int ms);
+void wait_us(int us);
+void wait(float s);
+
+#endif
@@ -0,0 +1,81 @@
+#include "mbed.h"
+#include "N5110.h"
+#include "HostBoard.h"
+#include "Profiler.h"
+
+/* Measures how much of the SPI transfer the game loop gets back now that
+ * N5110::refresh() streams the front buffer out in the background. Each frame
+ * draws a moving scene, refreshes, then spends a fixed time "simulating" the
+ * next frame. In blocking mode it waits for the transfer before simulating.
+ */
+
+#define FRAMES 200
+#define WORK_US 1000 // simulated game logic per frame
+
+static void drawScene(N5110 &lcd, int frame)
+{
+    lcd.clear();
+    lcd.drawRect(frame % 70, 8, 14, 20, FILL_BLACK);
+    lcd.drawCircle(42, 24, 5 + frame % 15, FILL_TRANSPARENT);
+    lcd.printString("FROGGER", 0, 5);
+}
+
+static long long runFrames(N5110 &lcd, bool blocking)
+{
+    long long const t0 = host_time_us();
+
+    for (int frame = 0; frame < FRAMES; frame++) {
+        drawScene(lcd, frame);
+        lcd.refresh();
+        if (blocking) {
+            lcd.waitForIdle();
+        }
+        wait_us(WORK_US);
+    }
+    lcd.waitForIdle();
+
+    return host_time_us() - t0;
+}
+
+// check the display model ended up with exactly what is in the buffer
+static bool displayMatches(N5110 &lcd)
+{
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            if (host_lcd_pixel(x, y) != lcd.getPixel(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    N5110 lcd;
+    lcd.init();
+
+#ifdef PROFILER_MODE
+    Profiler::init();
+#endif
+
+    for (int dirty = 0; dirty <= 1; dirty++) {
+        lcd.setDirtyTracking(dirty);
+
+        unsigned long const bytes0 = host_lcd_data_bytes();
+        long long const blocking = runFrames(lcd, true);
+        long long const overlapped = runFrames(lcd, false);
+        unsigned long const bytes = (host_lcd_data_bytes() - bytes0) / (2 * FRAMES);
+
+        printf("%-14s %4lu bytes/frame  blocking %6.3f ms/frame  overlapped %6.3f ms/frame  (work %.3f ms)  display %s\n",
+               dirty ? "dirty spans" : "full refresh", bytes,
+               blocking / 1000.0 / FRAMES, overlapped / 1000.0 / FRAMES, WORK_US / 1000.0,
+               displayMatches(lcd) ? "ok" : "MISMATCH");
+    }
+
+#ifdef PROFILER_MODE
+    Profiler::dump();  // refresh() time on the calling thread
+#endif
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <string.h>
+
+/* Flash used by the sprite data of a build, against a fixed baseline of what
+ * the game carried before the sprites were packed at compile time. It reads
+ * the symbol sizes of the image from nm:
+ *
+ *     make sprite-report ELF=<K64F image>
+ *
+ * runs arm-none-eabi-size on the image and pipes
+ * arm-none-eabi-nm --size-sort -S -C into this. Each copy of a symbol is
+ * counted, so a table that several translation units emit counts once per copy.
+ */
+
+// the sprite and background tables, both the 0/1 int tables and what replaced
+// them. Sprites.cpp emits <name>_bytes and a <name>_sprite descriptor for each
+// table it packs, Tiles.cpp emits the tile data for the backgrounds
+static const char *const sprite_names[] = {
+    // Background.h
+    "goal_post", "frog", "frogger_intro", "danger_zone", "safety_zone",
+    // Vehicle.h
+    "frog_state_up", "frog_state_down", "frog_state_left", "frog_state_right",
+    "bus", "left_racer", "right_racer", "left_normal", "right_normal", "star",
+    // WaterSprites.h
+    "medium_log", "log_big", "turtles_state_one", "turtles_state_two", "turtles_state_three",
+    // Tiles.cpp
+    "background_tiles", "safety_strip", "background_strips", "road_and_river_map",
+};
+
+struct SymbolSize {
+    const char *name;
+    int bytes;
+};
+
+// sprite data of the image before compile-time packing, when the int tables
+// were still defined in the headers (measured with nm --size-sort -S on an -Os
+// build of that tree). int is 4 bytes on the K64F too, so the tables are the
+// same size there
+static const SymbolSize baseline[] = {
+    { "frogger_intro", 6192 },
+    { "danger_zone", 2324 },
+    { "safety_zone", 1328 },
+    { "goal_post", 576 },
+    { "goal_post", 576 },  // emitted by two translation units
+    { "frog", 384 },
+    { "turtles_state_one", 320 },
+    { "turtles_state_two", 320 },
+    { "turtles_state_three", 320 },
+    { "log_big", 320 },
+    { "medium_log", 256 },
+    { "bus", 256 },
+    { "left_racer", 192 },
+    { "right_racer", 192 },
+    { "star", 192 },
+    { "left_normal", 160 },
+    { "right_normal", 160 },
+    { "frog_state_up", 96 },
+    { "frog_state_down", 96 },
+    { "frog_state_left", 96 },
+    { "frog_state_right", 96 },
+};
+
+// name, or name less a _bytes or _sprite suffix, is one of sprite_names
+static bool isSpriteSymbol(const char *name)
+{
+    int length = strlen(name);
+    static const char *const suffixes[] = { "_bytes", "_sprite" };
+
+    for (int i = 0; i < 2; i++) {
+        int const n = strlen(suffixes[i]);
+        if (length > n && strcmp(name + length - n, suffixes[i]) == 0) {
+            length -= n;
+            break;
+        }
+    }
+
+    for (unsigned int i = 0; i < sizeof(sprite_names) / sizeof(sprite_names[0]); i++) {
+        if ((int)strlen(sprite_names[i]) == length && strncmp(name, sprite_names[i], length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main()
+{
+    int before = 0;
+    int const before_count = sizeof(baseline) / sizeof(baseline[0]);
+    for (int i = 0; i < before_count; i++) {
+        before += baseline[i].bytes;
+    }
+
+    int after = 0;
+    int after_count = 0;
+    char line[512];
+
+    printf("%-28s %6s\n", "sprite data symbol", "bytes");
+    while (fgets(line, sizeof(line), stdin)) {
+        unsigned long long address;
+        unsigned long long size;
+        char type;
+        char name[400];
+
+        // "address size type name", undefined symbols have no address or size
+        if (sscanf(line, "%llx %llx %c %399[^\n]", &address, &size, &type, name) != 4) {
+            continue;
+        }
+        if (type == 't' || type == 'T' || !isSpriteSymbol(name)) {
+            continue;
+        }
+
+        printf("%-28s %6llu\n", name, size);
+        after += size;
+        after_count++;
+    }
+
+    if (after_count == 0) {
+        printf("no sprite data found, is this the nm --size-sort -S -C output of a game image?\n");
+        return 1;
+    }
+
+    printf("\nbefore: %6d bytes in %2d symbols (int tables, fixed baseline)\n", before, before_count);
+    printf("after:  %6d bytes in %2d symbols (%.1fx smaller)\n", after, after_count, (float)before / after);
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include "InputLog.h"
+
+InputLog::InputLog()
+    :
+    _log(_buffer),
+    _size(0),
+    _pos(0),
+    _recording(false),
+    _replaying(false),
+    _finished(false),
+    _overflow(false),
+    _frame(0),
+    _last_frame(-1),
+    _next_frame(-1),
+    _next_mask(0),
+    _end_frame(-1)
+{}
+
+void InputLog::record(unsigned int seed)
+{
+    _log = _buffer;
+    _size = 0;
+    _recording = true;
+    _replaying = false;
+    _finished = false;
+    _overflow = false;
+    _frame = 0;
+    _last_frame = -1;
+    
+    writeVarint(seed);
+}
+
+unsigned int InputLog::replay(const unsigned char *log, int size)
+{
+    _log = log;
+    _size = size;
+    _pos = 0;
+    _recording = false;
+    _replaying = true;
+    _finished = false;
+    _frame = 0;
+    _last_frame = -1;
+    _end_frame = -1;
+    
+    unsigned int seed = readVarint();
+    readEntry();
+    return seed;
+}
+
+bool InputLog::isRecording()
+{
+    return _recording;
+}
+
+bool InputLog::isReplaying()
+{
+    return _replaying;
+}
+
+bool InputLog::isFinished()
+{
+    return _finished;
+}
+
+void InputLog::recordPressed(int button)
+{
+    if (_recording) {
+        writeEntry(button);
+    }
+}
+
+bool InputLog::replayNext(int &button)
+{
+    while (_replaying && _next_frame <= _frame && _next_frame != _end_frame) {
+        if (_next_mask == 0) {
+            readEntry();
+            continue;
+        }
+        
+        int bit = _next_mask & -_next_mask; // lowest button first
+        _next_mask &= ~bit;
+        
+        if (_next_frame == _frame) {
+            button = bit;
+            return true;
+        }
+        // a press of a frame that was never read, skip it
+    }
+    return false;
+}
+
+void InputLog::endFrame()
+{
+    if (_replaying && _frame == _end_frame) {
+        _replaying = false; // played the last recorded frame
+        _finished = true;
+    }
+    _frame++;
+}
+
+void InputLog::dump()
+{
+    if (_recording) {
+        writeEntry(0); // end of session
+        _recording = false;
+    }
+    
+    if (_overflow) {
+        printf("// input log full, session cut short at frame %d\n", _last_frame);
+    }
+    printf("const unsigned char replay_log[] = {");
+    for (int i = 0; i < _size; i++) {
+        printf("%s0x%02X,", i % 12 ? " " : "\n    ", _log[i]);
+    }
+    printf("\n};\nconst int replay_log_size = %d;\n", _size);
+}
+
+int InputLog::getSize()
+{
+    return _size;
+}
+
+int InputLog::getFrame()
+{
+    return _frame;
+}
+
+// 7 bits per byte, low bits first, top bit set on all but the last byte
+void InputLog::writeVarint(unsigned int value)
+{
+    do {
+        if (_size >= INPUT_LOG_SIZE) {
+            _overflow = true;
+            _recording = false;
+            return;
+        }
+        unsigned char byte = value & 0x7F;
+        value >>= 7;
+        _buffer[_size++] = value ? byte | 0x80 : byte;
+    } while (value);
+}
+
+unsigned int InputLog::readVarint()
+{
+    unsigned int value = 0;
+    int shift = 0;
+    while (_pos < _size && shift < 32) {
+        unsigned char byte = _log[_pos++];
+        value |= (unsigned int)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            break;
+        }
+        shift += 7;
+    }
+    return value;
+}
+
+void InputLog::writeEntry(int mask)
+{
+    // one byte for the delta most of the time, the entry is never split
+    if (_size + 6 > INPUT_LOG_SIZE) {
+        _overflow = true;
+        _recording = false;
+        return;
+    }
+    writeVarint(_frame - _last_frame);
+    _buffer[_size++] = mask;
+    _last_frame = _frame;
+}
+
+void InputLog::readEntry()
+{
+    if (_pos >= _size) {
+        _replaying = false; // log ran out without an end marker
+        _finished = true;
+        return;
+    }
+    _next_frame = _last_frame + readVarint();
+    _next_mask = _pos < _size ? _log[_pos++] : 0;
+    _last_frame = _next_frame;
+    
+    if (_next_mask == 0) {
+        _end_frame = _next_frame; // end marker
+    }
+}
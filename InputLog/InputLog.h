@@ -0,0 +1,122 @@
+#ifndef INPUTLOG_H
+#define INPUTLOG_H
+
+#include "mbed.h"
+
+// 10 minutes at ~10 fps with a press every few frames fits in 8K
+#ifdef RECORD_MODE
+#define INPUT_LOG_SIZE 8192
+#else
+#define INPUT_LOG_SIZE 16 // not recording, replays read their log from flash
+#endif
+
+/** Buttons the game reads, the same bits as the Gamepad Button enum */
+enum InputButton
+{
+    INPUT_A = 1 << 0,
+    INPUT_B = 1 << 1,
+    INPUT_X = 1 << 2,
+    INPUT_Y = 1 << 3,
+    INPUT_START = 1 << 4
+};
+
+/** InputLog Class
+ *
+ * @brief Records the RNG seed and every button press the game reads, in order,
+ * @brief so a session can be replayed exactly. The log is a varint seed followed
+ * @brief by one entry per press: the varint number of frames since the last entry
+ * @brief (0 for another press in the same frame), then the button. An entry with
+ * @brief several buttons is several presses, lowest bit first, as older logs
+ * @brief stored a frame's presses. An entry with no buttons marks the last frame.
+ *
+ * @code
+ * seed = input_log.replay(replay_log, replay_log_size);
+ * srand(seed);
+ * ...
+ * while(input_log.replayNext(button)) { ... }
+ * input_log.endFrame();
+ * @endcode
+ */
+class InputLog
+{
+    public:
+        /** Constructor */
+        InputLog();
+        
+        /** @brief start a new recording
+         *  @param seed - the seed passed to srand() for this session
+         */
+        void record(unsigned int seed);
+        
+        /** @brief start replaying a log printed by dump()
+         *  @param log - the log
+         *  @param size - size of the log in bytes
+         *  @returns the seed the session was recorded with
+         */
+        unsigned int replay(const unsigned char *log, int size);
+        
+        /** @brief true while recording
+         */
+        bool isRecording();
+        
+        /** @brief true while replaying, until the last recorded frame is played
+         */
+        bool isReplaying();
+        
+        /** @brief true once the last recorded frame has been replayed
+         */
+        bool isFinished();
+        
+        /** @brief log a press read by the game this frame, call in the order 
+         *  @brief they were read
+         *  @param button - an InputButton
+         */
+        void recordPressed(int button);
+        
+        /** @brief replays the next press read in this frame of the recording
+         *  @param button - set to the InputButton
+         *  @returns false once this frame has no more presses
+         */
+        bool replayNext(int &button);
+        
+        /** @brief call once at the end of every frame
+         */
+        void endFrame();
+        
+        /** @brief ends the recording and prints it as a C array, ready to be replayed
+         */
+        void dump();
+        
+        /** @brief size of the log in bytes
+         */
+        int getSize();
+        
+        /** @brief number of frames since recording or replay started
+         */
+        int getFrame();
+        
+    private:
+    
+        void writeVarint(unsigned int value);
+        unsigned int readVarint();
+        void writeEntry(int mask);
+        void readEntry();
+        
+        unsigned char _buffer[INPUT_LOG_SIZE];
+        const unsigned char *_log; // log being replayed, or _buffer
+        int _size;
+        int _pos;
+        
+        bool _recording;
+        bool _replaying;
+        bool _finished;
+        bool _overflow;
+        
+        int _frame;
+        int _last_frame; // frame of the last entry
+        int _next_frame; // frame of the next entry to replay
+        int _next_mask; // presses of the entry not replayed yet
+        int _end_frame; // last frame of the session being replayed
+};
+
+#endif
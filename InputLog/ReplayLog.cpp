@@ -0,0 +1,7 @@
+#include "ReplayLog.h"
+
+// paste a recording here, this one is seed 1 and no input
+const unsigned char replay_log[] = {
+    0x01,
+};
+const int replay_log_size = 1;
@@ -0,0 +1,10 @@
+#ifndef REPLAYLOG_H
+#define REPLAYLOG_H
+
+/** Session replayed when built with REPLAY_MODE. Replace the arrays in
+ *  ReplayLog.cpp with the output of InputLog::dump() from a RECORD_MODE build.
+ */
+extern const unsigned char replay_log[];
+extern const int replay_log_size;
+
+#endif
@@ -1,4 +1,4 @@
-#include "IntroScreen.h"
-
-//IntroScreen::IntroScreen();
+#include "IntroScreen.h"
+
+//IntroScreen::IntroScreen();
 //IntroScreen::~IntroScreen();
\ No newline at end of file
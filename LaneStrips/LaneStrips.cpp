@@ -0,0 +1,85 @@
+#include "LaneStrips.h"
+
+#include <string.h>
+
+LaneStrips::LaneStrips()
+{
+    for(int lane = 0; lane < MAX_LANES; lane++)
+    {
+        _first[lane] = -1;
+        _sprite[lane] = NULL;
+    }
+}
+
+void LaneStrips::load(const LaneTable &lanes)
+{
+    int used = 0;
+    
+    for(int lane = 0; lane < MAX_LANES; lane++)
+    {
+        _sprite[lane] = NULL;
+        
+        if(lane < lanes.lanes && used + lanes.period[lane] <= LANE_STRIP_COLUMNS) {
+            _first[lane] = used;
+            used += lanes.period[lane];
+        } else {
+            _first[lane] = -1;
+        }
+    }
+}
+
+void LaneStrips::draw(N5110 &lcd, const LaneTable &lanes, int lane, const PackedSprite *sprite, int flip)
+{
+    if(!sprite) {
+        return;
+    }
+    
+    if(_first[lane] < 0 || sprite->height > 8) {
+        int end = lanes.first[lane] + lanes.count[lane];
+        
+        for(int i = lanes.first[lane]; i < end; i++)
+        {
+            lcd.drawPackedSprite(lanes.x[i].toInt(), lanes.y[lane], *sprite, flip);
+        }
+        return;
+    }
+    
+    if(_sprite[lane] != sprite) {
+        render(lanes, lane, *sprite, flip);
+    }
+    
+    // screen column 0 shows the strip column whose object is at x = 0
+    int period = lanes.period[lane];
+    int start = lanes.width[lane] - lanes.scroll[lane].toInt();
+    if(start < 0) {
+        start += period;
+    }
+    
+    lcd.drawStrip(lanes.y[lane], sprite->height, _columns + _first[lane], period, start);
+}
+
+void LaneStrips::render(const LaneTable &lanes, int lane, const PackedSprite &sprite, int flip)
+{
+    unsigned char *strip = _columns + _first[lane];
+    int period = lanes.period[lane];
+    int width = sprite.width < period ? sprite.width : period;
+    
+    memset(strip, 0, period);
+    
+    int end = lanes.first[lane] + lanes.count[lane];
+    
+    for(int i = lanes.first[lane]; i < end; i++)
+    {
+        int col = lanes.slot[i];
+        
+        for(int c = 0; c < width; c++)
+        {
+            strip[col] = N5110::flippedColumn(sprite, 0, c, flip);
+            if(++col == period) {
+                col = 0;
+            }
+        }
+    }
+    
+    _sprite[lane] = &sprite;
+}
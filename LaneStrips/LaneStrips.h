@@ -0,0 +1,49 @@
+#ifndef LANESTRIPS_H
+#define LANESTRIPS_H
+
+#include "N5110.h"
+#include "LaneTable.h"
+
+#define LANE_STRIP_COLUMNS 1024 // columns of the strips of every lane of one level
+
+/** LaneStrips Class
+ *
+ * @brief Cache of one rendered period of every lane. A lane is the same sprite
+ * @brief at fixed slots scrolling as one, so it's drawn as a single screen wide
+ * @brief window of its strip at the lane's scroll, however many objects it has.
+ * @brief A strip is rendered again when its sprite changes (the turtles dive).
+ * @brief The strips share one pool, a lane that doesn't fit is drawn object by
+ * @brief object instead.
+ */
+class LaneStrips
+{
+    public:
+        /** Constructor, no strips */
+        LaneStrips();
+        
+        /** @brief shares the pool out between the lanes of a level, call once
+         *  @brief they're loaded. Each strip is rendered the first time it's drawn
+         *  @param lanes - the lanes of the level
+         */
+        void load(const LaneTable &lanes);
+        
+        /** @brief draws a lane over the whole screen width, its rows are the
+         *  @brief lane's, clear pixels and the gaps are white
+         *  @param lcd - lcd to draw on
+         *  @param lanes - the lanes, at their current scroll
+         *  @param lane - lane to draw
+         *  @param sprite - current frame of the lane's objects, NULL draws nothing
+         *  @param flip - SpriteFlip of the lane
+         */
+        void draw(N5110 &lcd, const LaneTable &lanes, int lane, const PackedSprite *sprite, int flip);
+        
+    private:
+    
+        void render(const LaneTable &lanes, int lane, const PackedSprite &sprite, int flip);
+        
+        unsigned char _columns[LANE_STRIP_COLUMNS]; // the strips, lane after lane
+        int _first[MAX_LANES]; // first column of each lane's strip, -1 if it doesn't fit
+        const PackedSprite *_sprite[MAX_LANES]; // sprite each strip was rendered with
+};
+
+#endif
@@ -0,0 +1,119 @@
+#include "LaneTable.h"
+#include "Profiler.h"
+
+static_assert(MAX_LANES <= 16, "band_lanes has one bit per lane");
+
+LaneTable::LaneTable()
+{
+    clear();
+}
+
+void LaneTable::clear()
+{
+    lanes = 0;
+    objects = 0;
+    
+    for(int band = 0; band < LANE_BANDS; band++)
+    {
+        band_lanes[band] = 0;
+    }
+}
+
+void LaneTable::load(const LevelDef &level)
+{
+    clear();
+    
+    for(int i = 0; i < level.lane_count; i++)
+    {
+        const LaneDef &lane = level.lanes[i];
+        addLane(lane.row, lane.count, lane.spacing, lane.sprite, lane.speed_class, lane.dir);
+    }
+}
+
+bool LaneTable::addLane(int row, int count, int spacing, char sprite, int speed_class, int dir)
+{
+    if(lanes == MAX_LANES || objects + count > MAX_LANE_OBJECTS) {
+        return false;
+    }
+    
+    int lane = lanes++;
+    
+    this->y[lane] = 48 - 4 * row;
+    this->velocity[lane] = dir == 2 ? -object_velocity[speed_class] : object_velocity[speed_class];
+    this->sprite[lane] = sprite;
+    this->flip[lane] = objectFlip(sprite, dir);
+    this->first[lane] = objects;
+    this->count[lane] = count;
+    objectSize(sprite, this->width[lane], this->height[lane]);
+    
+    // one gap after the last object before the first comes round again
+    int last = count > 0 ? spacing << (count - 1) : 0;
+    this->period[lane] = last + spacing > 84 + width[lane] ? last + spacing : 84 + width[lane];
+    this->scroll[lane] = 0;
+    
+    // the lane is in every band its objects overlap, so taller sprites or lanes
+    // off the band grid cover more than one
+    for(int band = y[lane] / 4; band <= (y[lane] + height[lane] - 1) / 4 && band < LANE_BANDS; band++)
+    {
+        band_lanes[band] |= 1 << lane;
+    }
+    
+    for(int i = 0; i < count; i++)
+    {
+        // starts at x = spacing, like the original rows
+        slot[objects] = (spacing + width[lane]) % period[lane];
+        x[objects] = slot[objects] - width[lane];
+        objects++;
+        spacing += spacing; // ensure that each object has appropriate seperation
+    }
+    return true;
+}
+
+void LaneTable::update()
+{
+    PROFILE_ZONE(ZONE_MOVE_LANES);
+    
+    for(int lane = 0; lane < lanes; lane++)
+    {
+        Fixed p = period[lane];
+        Fixed s = scroll[lane] + velocity[lane];
+        
+        if(s >= p) {
+            s -= p;
+        } else if(s < 0) {
+            s += p;
+        }
+        scroll[lane] = s;
+        
+        // off the screen at -width, back on the other side at period - width
+        Fixed w = width[lane];
+        int end = first[lane] + count[lane];
+        
+        for(int i = first[lane]; i < end; i++)
+        {
+            Fixed pos = s + slot[i];
+            if(pos >= p) {
+                pos -= p;
+            }
+            x[i] = pos - w;
+        }
+    }
+}
+
+unsigned int LaneTable::lanesBetween(int top, int bottom)
+{
+    if(top < 0) {
+        top = 0;
+    }
+    if(bottom > LANE_BANDS * 4) {
+        bottom = LANE_BANDS * 4;
+    }
+    
+    unsigned int mask = 0;
+    
+    for(int band = top / 4; band <= (bottom - 1) / 4; band++)
+    {
+        mask |= band_lanes[band];
+    }
+    return mask;
+}
@@ -0,0 +1,126 @@
+#ifndef LANETABLE_H
+#define LANETABLE_H
+
+#include "Object.h"
+#include "Levels.h"
+
+#define MAX_LANES 12 // rows 1 to 11 of the screen, plus a spare
+#define MAX_LANE_OBJECTS 32 // objects of all the lanes of one level
+#define LANE_BANDS 12 // 4 pixel high bands of the screen, for the collision broad phase
+
+/** LaneTable Class
+ *
+ * @brief The moving objects of the current level, stored lane by lane. Each lane
+ * @brief has one speed, direction, sprite and size, the x positions of all the
+ * @brief lanes share one contiguous array, so moving every object of the level
+ * @brief is one loop over it. Levels are tables of lanes in flash (Levels.cpp)
+ * @brief that load() copies in. Every 4 pixel band of the screen keeps a mask 
+ * @brief of the lanes covering it, so collision only tests the lanes the frog is in.
+ * @brief Every lane repeats after its period and scrolls as one, an object is
+ * @brief its slot in the period plus the lane's scroll, so a lane can be drawn
+ * @brief from one pre-rendered period (LaneStrips).
+ */
+class LaneTable
+{
+    public:
+        /** Constructor, no lanes */
+        LaneTable();
+        
+        /** @brief removes every lane, call before setting up a level
+         */
+        void clear();
+        
+        /** @brief replaces the lanes with the lanes of a level
+         *  @param level - level from the levels table
+         */
+        void load(const LevelDef &level);
+        
+        /** @brief adds a lane of objects, spaced out like the original rows 
+         *  @brief (the gap doubles after each object). The lane repeats after
+         *  @brief the last object and one more gap, or once it's off the screen
+         *  @param row - row of the lane, 1 is the bottom of the screen
+         *  @param count - number of objects in the lane
+         *  @param spacing - x pos of the first object
+         *  @param sprite - sprite of the objects, the graphic engine knows the type
+         *  @param speed_class - a SpeedClass
+         *  @param dir - 1 (right) or 2 (left)
+         *  @returns false if the table is full, the lane isn't added
+         */
+        bool addLane(int row, int count, int spacing, char sprite, int speed_class, int dir);
+        
+        /** @brief scrolls every lane by its velocity, objects leaving the 
+         *  @brief screen come back on the other side one period later
+         */
+        void update();
+        
+        /** @brief lanes that cover any of the pixel rows top to bottom
+         *  @param top - first pixel row
+         *  @param bottom - one past the last pixel row
+         *  @returns bit i is set if lane i covers one of the rows
+         */
+        unsigned int lanesBetween(int top, int bottom);
+        
+        /** @brief number of lanes in the table
+         */
+        int lanes;
+        
+        /** @brief number of objects in the table, across all lanes
+         */
+        int objects;
+        
+        /** @brief y pos of each lane
+         */
+        int y[MAX_LANES];
+        
+        /** @brief signed pixels per frame of each lane, negative moves left
+         */
+        Fixed velocity[MAX_LANES];
+        
+        /** @brief sprite of each lane
+         */
+        char sprite[MAX_LANES];
+        
+        /** @brief SpriteFlip the sprite of each lane is drawn with
+         */
+        uint8_t flip[MAX_LANES];
+        
+        /** @brief index of the first object of each lane in x
+         */
+        int first[MAX_LANES];
+        
+        /** @brief number of objects of each lane
+         */
+        int count[MAX_LANES];
+        
+        /** @brief width of the rectangle of the lane's objects
+         */
+        int width[MAX_LANES];
+        
+        /** @brief height of the rectangle of the lane's objects
+         */
+        int height[MAX_LANES];
+        
+        /** @brief columns after which each lane repeats, at least the screen
+         *  @brief and one object so an object is never on it twice
+         */
+        int period[MAX_LANES];
+        
+        /** @brief how far each lane has scrolled, 0 up to its period
+         */
+        Fixed scroll[MAX_LANES];
+        
+        /** @brief x pos of every object, lane after lane
+         */
+        Fixed x[MAX_LANE_OBJECTS];
+        
+        /** @brief column of every object in its lane's period, x is the slot
+         *  @brief plus the scroll, wrapped to the period, less the width
+         */
+        int slot[MAX_LANE_OBJECTS];
+        
+        /** @brief lanes covering each band, bit i is lane i
+         */
+        uint16_t band_lanes[LANE_BANDS];
+};
+
+#endif
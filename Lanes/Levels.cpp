@@ -0,0 +1,47 @@
+#include "Levels.h"
+#include "Object.h"
+#include "Tiles.h"
+
+// rows 2 to 5 are the road, 7 to 9 the river
+// row, count, spacing, sprite, speed, direction
+static constexpr LaneDef level_one_lanes[] = {
+    // vehicles
+    {2, 3, 20, 'N', SPEED_SLOW, 2},
+    {3, 2, 25, 'N', SPEED_MEDIUM, 1},
+    {4, 3, 30, 'B', SPEED_SLOW, 2},
+    {5, 4, 25, 'R', SPEED_MEDIUM, 1},
+    
+    // logs
+    {7, 3, 20, 'G', SPEED_SLOW, 1},
+    {8, 2, 30, 'M', SPEED_MEDIUM, 2},
+    {9, 3, 25, 'G', SPEED_SLOW, 1},
+};
+
+static constexpr LaneDef level_two_lanes[] = {
+    // vehicles
+    {2, 4, 15, 'R', SPEED_MEDIUM, 1},
+    {3, 3, 20, 'R', SPEED_MEDIUM, 2},
+    {4, 4, 25, 'N', SPEED_FAST, 1},
+    {5, 3, 25, 'N', SPEED_FAST, 2},
+    
+    // logs and turtles
+    {7, 2, 20, 'M', SPEED_FAST, 1},
+    {8, 2, 30, 'T', SPEED_MEDIUM, 2},
+    {9, 3, 25, 'G', SPEED_FAST, 1},
+};
+
+static constexpr LaneDef bonus_lanes[] = {
+    {2, 4, 15, 'S', SPEED_FAST, 2},
+    {3, 3, 20, 'S', SPEED_ULTRA, 1},
+    {4, 3, 25, 'S', SPEED_ULTRA, 1},
+    {7, 2, 20, 'S', SPEED_ULTRA, 2},
+    {9, 3, 25, 'S', SPEED_FAST, 1},
+};
+
+#define LANES(table) table, sizeof(table) / sizeof(table[0])
+
+constexpr LevelDef levels[LEVEL_COUNT] = {
+    {LANES(bonus_lanes), 7, 36, &road_and_river_map},     // LEVEL_BONUS
+    {LANES(level_one_lanes), 7, 36, &road_and_river_map}, // LEVEL_ONE
+    {LANES(level_two_lanes), 7, 36, &road_and_river_map}, // LEVEL_TWO
+};
@@ -0,0 +1,41 @@
+#ifndef LEVELS_H
+#define LEVELS_H
+
+#include <stdint.h>
+
+struct TileMap;
+
+/** index of each level in the levels table, it's also the current_level of Frogger */
+enum LevelId
+{
+    LEVEL_BONUS, /**< bonus round, from the main menu */
+    LEVEL_ONE,   /**< first level of the game */
+    LEVEL_TWO,   /**< second level, faster with turtles */
+    LEVEL_COUNT
+};
+
+/** one lane of a level, loaded into the LaneTable by LaneTable::addLane */
+struct LaneDef
+{
+    uint8_t row;         /**< row of the lane, 1 is the bottom of the screen */
+    uint8_t count;       /**< number of objects */
+    uint8_t spacing;     /**< x pos of the first object, the gap doubles after each one */
+    char sprite;         /**< sprite of the objects */
+    uint8_t speed_class; /**< a SpeedClass */
+    uint8_t dir;         /**< 1 (right) or 2 (left) */
+};
+
+/** a whole level, constant data that stays in flash */
+struct LevelDef
+{
+    const LaneDef *lanes;      /**< lanes of the level, bottom first */
+    uint8_t lane_count;        /**< number of lanes */
+    uint8_t water_row;         /**< rows from this one up are water, the frog has to ride on something */
+    uint8_t goal_x;            /**< x pos of the goal post */
+    const TileMap *background; /**< static background, the goal post is drawn over it */
+};
+
+/** every level of the game, indexed by LevelId */
+extern const LevelDef levels[LEVEL_COUNT];
+
+#endif
@@ -1,507 +1,1072 @@
-#include "mbed.h"
-#include "N5110.h"
-
-// overloaded constructor includes power pin - LCD Vcc connected to GPIO pin
-// this constructor works fine with LPC1768 - enough current sourced from GPIO
-// to power LCD. Doesn't work well with K64F.
-N5110::N5110(PinName const pwrPin,
-             PinName const scePin,
-             PinName const rstPin,
-             PinName const dcPin,
-             PinName const mosiPin,
-             PinName const sclkPin,
-             PinName const ledPin)
-    :
-    _spi(new SPI(mosiPin,NC,sclkPin)), // create new SPI instance and initialise
-    _led(new DigitalOut(ledPin)),
-    _pwr(new DigitalOut(pwrPin)),
-    _sce(new DigitalOut(scePin)),
-    _rst(new DigitalOut(rstPin)),
-    _dc(new DigitalOut(dcPin))
-{}
-
-// overloaded constructor does not include power pin - LCD Vcc must be tied to +3V3
-// Best to use this with K64F as the GPIO hasn't sufficient output current to reliably
-// drive the LCD.
-N5110::N5110(PinName const scePin,
-             PinName const rstPin,
-             PinName const dcPin,
-             PinName const mosiPin,
-             PinName const sclkPin,
-             PinName const ledPin)
-    :
-    _spi(new SPI(mosiPin,NC,sclkPin)), // create new SPI instance and initialise
-    _led(new DigitalOut(ledPin)),
-    _pwr(NULL), // pwr not needed so null it to be safe
-    _sce(new DigitalOut(scePin)),
-    _rst(new DigitalOut(rstPin)),
-    _dc(new DigitalOut(dcPin))
-{}
-// Second overload contructor uses the New Gamepad (Rev 2.1) pin mappings
-N5110::N5110()
-    :
-    _spi(new SPI(PTD2,NC,PTD1)), // create new SPI instance and initialise
-    _led(new DigitalOut(PTB23)),
-    _pwr(NULL), // pwr not needed so null it to be safe
-    _sce(new DigitalOut(PTB19)),
-    _rst(new DigitalOut(PTC1)),
-    _dc(new DigitalOut(PTB18))
-{}
-
-N5110::~N5110()
-{
-    delete _spi;
-
-    if(_pwr) {
-        delete _pwr;
-    }
-
-    delete _led;
-    delete _sce;
-    delete _rst;
-    delete _dc;
-}
-
-// initialise function - powers up and sends the initialisation commands
-void N5110::init()
-{
-    turnOn();     // power up
-    reset();      // reset LCD - must be done within 100 ms
-    initSPI();    
-    
-    backLightOn();
-    setContrast(0.55);  // this may need tuning (say 0.4 to 0.6)
-    setBias(3);   // datasheet - 48:1 mux - don't mess with if you don't know what you're doing! (0 to 7)
-    setTempCoefficient(0); // datasheet - may need increasing (range 0 to 3) at very low temperatures
-    normalMode();  // normal video mode by default
-    
-    clearRAM();      // RAM is undefined at power-up so clear to be sure
-    clear();   // clear buffer
-}
-
-// sets normal video mode (black on white)
-void N5110::normalMode()
-{
-    sendCommand(0b00100000);   // basic instruction
-    sendCommand(0b00001100);  // normal video mode- datasheet
-}
-
-// sets normal video mode (white on black)
-void N5110::inverseMode()
-{
-    sendCommand(0b00100000);   // basic instruction
-    sendCommand(0b00001101);   // inverse video mode - datasheet
-}
-
-// function to power up the LCD and backlight - only works when using GPIO to power
-void N5110::turnOn()
-{
-    if (_pwr != NULL) {
-        _pwr->write(1);  // apply power
-    }
-}
-
-// function to power down LCD
-void N5110::turnOff()
-{
-    clear(); // clear buffer
-    refresh();
-    backLightOff(); // turn backlight off
-    clearRAM();   // clear RAM to ensure specified current consumption
-    // send command to ensure we are in basic mode
-    
-    sendCommand(0b00100000); // basic mode
-    sendCommand(0b00001000); // clear display
-    sendCommand(0b00100001); // extended mode
-    sendCommand(0b00100100); // power down
-    
-    // if we are powering the LCD using the GPIO then make it low to turn off
-    if (_pwr != NULL) {
-        wait_ms(10);  // small delay and then turn off the power pin
-        _pwr->write(0);  // turn off power
-    }
-
-}
-
-// function to change LED backlight brightness
-void N5110::backLightOn()
-{
-    _led->write(1);
-}
-
-// function to change LED backlight brightness
-void N5110::backLightOff()
-{
-    _led->write(0);
-}
-
-void N5110::setContrast(float contrast) {
-    
-    // enforce limits
-    if (contrast > 1.0f)
-        contrast = 1.0f;
-    else if (contrast < 0.0f)
-        contrast = 0.0;
-    
-    // convert to char in range 0 to 127 (i.e. 6 bits)
-    char ic = char(contrast*127.0f);
-    
-    sendCommand(0b00100001);  // extended instruction set
-    sendCommand(0b10000000 | ic);   // set Vop (which controls contrast)
-    sendCommand(0b00100000);  // back to basic instruction set
-}
-
-void N5110::setTempCoefficient(char tc) {
-    
-    // enforce limits
-    if (tc>3) {
-        tc=3;
-    }
-    
-    // temperature coefficient may need increasing at low temperatures
-
-    sendCommand(0b00100001);  // extended instruction set
-    sendCommand(0b00000100 | tc);
-    sendCommand(0b00100000);  // back to basic instruction set
-}
-    
-void N5110::setBias(char bias) {
-    
-    // from data sheet
-    // bias      mux rate
-    // 0        1:100
-    // 1        1:80
-    // 2        1:65
-    // 3        1:48   (default)
-    // 4        1:40/1:34
-    // 5        1:24
-    // 6        1:18/1:16
-    // 7        1:10/1:9/1:8
-    
-    // enforce limits
-    if (bias>7) {
-        bias=7;
-    }
-        
-    sendCommand(0b00100001);  // extended mode instruction
-    sendCommand(0b00010000 | bias);  
-    sendCommand(0b00100000); // end of extended mode instruction
-}
-
-// pulse the active low reset line
-void N5110::reset()
-{
-    _rst->write(0);  // reset the LCD
-    _rst->write(1);
-}
-
-// function to initialise SPI peripheral
-void N5110::initSPI()
-{
-    _spi->format(8,1);    // 8 bits, Mode 1 - polarity 0, phase 1 - base value of clock is 0, data captured on falling edge/propagated on rising edge
-    _spi->frequency(4000000);  // maximum of screen is 4 MHz
-}
-
-// send a command to the display
-void N5110::sendCommand(unsigned char command)
-{
-    _dc->write(0);  // set DC low for command
-    _sce->write(0); // set CE low to begin frame
-    _spi->write(command);  // send command
-    _dc->write(1);  // turn back to data by default
-    _sce->write(1); // set CE high to end frame (expected for transmission of single byte)
-}
-
-// send data to the display at the current XY address
-// dc is set to 1 (i.e. data) after sending a command and so should
-// be the default mode.
-void N5110::sendData(unsigned char data)
-{
-    _sce->write(0);   // set CE low to begin frame
-    _spi->write(data);
-    _sce->write(1);  // set CE high to end frame (expected for transmission of single byte)
-}
-
-// this function writes 0 to the 504 bytes to clear the RAM
-void N5110::clearRAM()
-{
-    _sce->write(0);  //set CE low to begin frame
-    for(int i = 0; i < WIDTH * HEIGHT; i++) { // 48 x 84 bits = 504 bytes
-        _spi->write(0x00);  // send 0's
-    }
-    _sce->write(1); // set CE high to end frame
-}
-
-// function to set the XY address in RAM for subsequenct data write
-void N5110::setXYAddress(unsigned int const x,
-                         unsigned int const y)
-{
-    if (x<WIDTH && y<HEIGHT) {  // check within range
-        sendCommand(0b00100000);  // basic instruction
-        sendCommand(0b10000000 | x);  // send addresses to display with relevant mask
-        sendCommand(0b01000000 | y);
-    }
-}
-
-// These functions are used to set, clear and get the value of pixels in the display
-// Pixels are addressed in the range of 0 to 47 (y) and 0 to 83 (x).  The refresh()
-// function must be called after set and clear in order to update the display
-void N5110::setPixel(unsigned int const x,
-                     unsigned int const y,
-                     bool const         state)
-{
-    if (x<WIDTH && y<HEIGHT) {  // check within range
-        // calculate bank and shift 1 to required position in the data byte
-        if(state) buffer[x][y/8] |= (1 << y%8);
-        else      buffer[x][y/8] &= ~(1 << y%8);
-    }
-}
-
-void N5110::clearPixel(unsigned int const x,
-                       unsigned int const y)
-{
-    if (x<WIDTH && y<HEIGHT) {  // check within range
-        // calculate bank and shift 1 to required position (using bit clear)
-        buffer[x][y/8] &= ~(1 << y%8);
-    }
-}
-
-int N5110::getPixel(unsigned int const x,
-                    unsigned int const y) const
-{
-    if (x<WIDTH && y<HEIGHT) {  // check within range
-        // return relevant bank and mask required bit
-
-        int pixel = (int) buffer[x][y/8] & (1 << y%8);
-
-        if (pixel)
-            return 1;
-        else
-            return 0;
-    }
-
-    return 0;
-
-}
-
-// function to refresh the display
-void N5110::refresh()
-{
-    setXYAddress(0,0);  // important to set address back to 0,0 before refreshing display
-    // address auto increments after printing string, so buffer[0][0] will not coincide
-    // with top-left pixel after priting string
-
-    _sce->write(0);  //set CE low to begin frame
-
-    for(int j = 0; j < BANKS; j++) {  // be careful to use correct order (j,i) for horizontal addressing
-        for(int i = 0; i < WIDTH; i++) {
-            _spi->write(buffer[i][j]);  // send buffer
-        }
-    }
-    _sce->write(1); // set CE high to end frame
-
-}
-
-// fills the buffer with random bytes.  Can be used to test the display.
-// The rand() function isn't seeded so it probably creates the same pattern everytime
-void N5110::randomiseBuffer()
-{
-    int i,j;
-    for(j = 0; j < BANKS; j++) {  // be careful to use correct order (j,i) for horizontal addressing
-        for(i = 0; i < WIDTH; i++) {
-            buffer[i][j] = rand()%256;  // generate random byte
-        }
-    }
-
-}
-
-// function to print 5x7 font
-void N5110::printChar(char const          c,
-                      unsigned int const  x,
-                      unsigned int const  y)
-{
-    if (y<BANKS) {  // check if printing in range of y banks
-
-        for (int i = 0; i < 5 ; i++ ) {
-            int pixel_x = x+i;
-            if (pixel_x > WIDTH-1)  // ensure pixel isn't outside the buffer size (0 - 83)
-                break;
-            buffer[pixel_x][y] = font5x7[(c - 32)*5 + i];
-            // array is offset by 32 relative to ASCII, each character is 5 pixels wide
-        }
-
-    }
-}
-
-// function to print string at specified position
-void N5110::printString(const char         *str,
-                        unsigned int const  x,
-                        unsigned int const  y)
-{
-    if (y<BANKS) {  // check if printing in range of y banks
-
-        int n = 0 ; // counter for number of characters in string
-        // loop through string and print character
-        while(*str) {
-
-            // writes the character bitmap data to the buffer, so that
-            // text and pixels can be displayed at the same time
-            for (int i = 0; i < 5 ; i++ ) {
-                int pixel_x = x+i+n*6;
-                if (pixel_x > WIDTH-1) // ensure pixel isn't outside the buffer size (0 - 83)
-                    break;
-                buffer[pixel_x][y] = font5x7[(*str - 32)*5 + i];
-            }
-            str++;  // go to next character in string
-            n++;    // increment index
-        }
-    }
-}
-
-// function to clear the screen buffer
-void N5110::clear()
-{
-    memset(buffer,0,sizeof(buffer));
-}
-
-// function to plot array on display
-void N5110::plotArray(float const array[])
-{
-    for (int i=0; i<WIDTH; i++) {  // loop through array
-        // elements are normalised from 0.0 to 1.0, so multiply
-        // by 47 to convert to pixel range, and subtract from 47
-        // since top-left is 0,0 in the display geometry
-        setPixel(i,47 - int(array[i]*47.0f),true);
-    }
-
-}
-
-// function to draw circle
-void N5110:: drawCircle(unsigned int const x0,
-                        unsigned int const y0,
-                        unsigned int const radius,
-                        FillType const     fill)
-{
-    // from http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-    int x = radius;
-    int y = 0;
-    int radiusError = 1-x;
-
-    while(x >= y) {
-
-        // if transparent, just draw outline
-        if (fill == FILL_TRANSPARENT) {
-            setPixel( x + x0,  y + y0,true);
-            setPixel(-x + x0,  y + y0,true);
-            setPixel( y + x0,  x + y0,true);
-            setPixel(-y + x0,  x + y0,true);
-            setPixel(-y + x0, -x + y0,true);
-            setPixel( y + x0, -x + y0,true);
-            setPixel( x + x0, -y + y0,true);
-            setPixel(-x + x0, -y + y0,true);
-        } else {  // drawing filled circle, so draw lines between points at same y value
-
-            int type = (fill==FILL_BLACK) ? 1:0;  // black or white fill
-
-            drawLine(x+x0,y+y0,-x+x0,y+y0,type);
-            drawLine(y+x0,x+y0,-y+x0,x+y0,type);
-            drawLine(y+x0,-x+y0,-y+x0,-x+y0,type);
-            drawLine(x+x0,-y+y0,-x+x0,-y+y0,type);
-        }
-
-        y++;
-        if (radiusError<0) {
-            radiusError += 2 * y + 1;
-        } else {
-            x--;
-            radiusError += 2 * (y - x) + 1;
-        }
-    }
-
-}
-
-void N5110::drawLine(unsigned int const x0,
-                     unsigned int const y0,
-                     unsigned int const x1,
-                     unsigned int const y1,
-                     unsigned int const type)
-{
-    // Note that the ranges can be negative so we have to turn the input values
-    // into signed integers first
-    int const y_range = static_cast<int>(y1) - static_cast<int>(y0);
-    int const x_range = static_cast<int>(x1) - static_cast<int>(x0);
-
-    // if dotted line, set step to 2, else step is 1
-    unsigned int const step = (type==2) ? 2:1;
-
-    // make sure we loop over the largest range to get the most pixels on the display
-    // for instance, if drawing a vertical line (x_range = 0), we need to loop down the y pixels
-    // or else we'll only end up with 1 pixel in the x column
-    if ( abs(x_range) > abs(y_range) ) {
-
-        // ensure we loop from smallest to largest or else for-loop won't run as expected
-        unsigned int const start = x_range > 0 ? x0:x1;
-        unsigned int const stop =  x_range > 0 ? x1:x0;
-
-        // loop between x pixels
-        for (unsigned int x = start; x<= stop ; x+=step) {
-            // do linear interpolation
-            int const dx = static_cast<int>(x)-static_cast<int>(x0);
-            unsigned int const y = y0 + y_range * dx / x_range;
-
-            // If the line type is '0', this will clear the pixel
-            // If it is '1' or '2', the pixel will be set
-            setPixel(x,y, type);
-        }
-    } else {
-
-        // ensure we loop from smallest to largest or else for-loop won't run as expected
-        unsigned int const start = y_range > 0 ? y0:y1;
-        unsigned int const stop =  y_range > 0 ? y1:y0;
-
-        for (unsigned int y = start; y<= stop ; y+=step) {
-            // do linear interpolation
-            int const dy = static_cast<int>(y)-static_cast<int>(y0);
-            unsigned int const x = x0 + x_range * dy / y_range;
-
-            // If the line type is '0', this will clear the pixel
-            // If it is '1' or '2', the pixel will be set
-            setPixel(x,y, type);
-        }
-    }
-
-}
-
-void N5110::drawRect(unsigned int const x0,
-                     unsigned int const y0,
-                     unsigned int const width,
-                     unsigned int const height,
-                     FillType const     fill)
-{
-    if (fill == FILL_TRANSPARENT) { // transparent, just outline
-        drawLine(x0,y0,x0+(width-1),y0,1);  // top
-        drawLine(x0,y0+(height-1),x0+(width-1),y0+(height-1),1);  // bottom
-        drawLine(x0,y0,x0,y0+(height-1),1);  // left
-        drawLine(x0+(width-1),y0,x0+(width-1),y0+(height-1),1);  // right
-    } else { // filled rectangle
-        int type = (fill==FILL_BLACK) ? 1:0;  // black or white fill
-        for (int y = y0; y<y0+height; y++) {  // loop through rows of rectangle
-            drawLine(x0,y,x0+(width-1),y,type);  // draw line across screen
-        }
-    }
-}
-
-void N5110::drawSprite(int x0,
-                       int y0,
-                       int nrows,
-                       int ncols,
-                       int *sprite)
-{
-    for (int i = 0; i < nrows; i++) {
-        for (int j = 0 ; j < ncols ; j++) {
-
-            int pixel = *((sprite+i*ncols)+j);
-            setPixel(x0+j,y0+i, pixel);
-        }
-    }
-}
\ No newline at end of file
+#include "mbed.h"
+#include "N5110.h"
+#include "Profiler.h"
+
+// overloaded constructor includes power pin - LCD Vcc connected to GPIO pin
+// this constructor works fine with LPC1768 - enough current sourced from GPIO
+// to power LCD. Doesn't work well with K64F.
+N5110::N5110(PinName const pwrPin,
+             PinName const scePin,
+             PinName const rstPin,
+             PinName const dcPin,
+             PinName const mosiPin,
+             PinName const sclkPin,
+             PinName const ledPin)
+    :
+    _spi(new SPI(mosiPin,NC,sclkPin)), // create new SPI instance and initialise
+    _led(new DigitalOut(ledPin)),
+    _pwr(new DigitalOut(pwrPin)),
+    _sce(new DigitalOut(scePin)),
+    _rst(new DigitalOut(rstPin)),
+    _dc(new DigitalOut(dcPin)),
+    _dirty_tracking(false), // send the whole buffer by default
+    _refresh_bytes(0),
+    _span_count(0),
+    _busy(false)
+{
+    // nothing is dirty until the buffer is written to, as after a refresh
+    memset(_dirty_lo,WIDTH,sizeof(_dirty_lo));
+    memset(_dirty_hi,0,sizeof(_dirty_hi));
+
+#ifdef OVERDRAW_MODE
+    resetOverdraw();
+#endif
+}
+
+// overloaded constructor does not include power pin - LCD Vcc must be tied to +3V3
+// Best to use this with K64F as the GPIO hasn't sufficient output current to reliably
+// drive the LCD.
+N5110::N5110(PinName const scePin,
+             PinName const rstPin,
+             PinName const dcPin,
+             PinName const mosiPin,
+             PinName const sclkPin,
+             PinName const ledPin)
+    :
+    _spi(new SPI(mosiPin,NC,sclkPin)), // create new SPI instance and initialise
+    _led(new DigitalOut(ledPin)),
+    _pwr(NULL), // pwr not needed so null it to be safe
+    _sce(new DigitalOut(scePin)),
+    _rst(new DigitalOut(rstPin)),
+    _dc(new DigitalOut(dcPin)),
+    _dirty_tracking(false), // send the whole buffer by default
+    _refresh_bytes(0),
+    _span_count(0),
+    _busy(false)
+{
+    // nothing is dirty until the buffer is written to, as after a refresh
+    memset(_dirty_lo,WIDTH,sizeof(_dirty_lo));
+    memset(_dirty_hi,0,sizeof(_dirty_hi));
+
+#ifdef OVERDRAW_MODE
+    resetOverdraw();
+#endif
+}
+// Second overload contructor uses the New Gamepad (Rev 2.1) pin mappings
+N5110::N5110()
+    :
+    _spi(new SPI(PTD2,NC,PTD1)), // create new SPI instance and initialise
+    _led(new DigitalOut(PTB23)),
+    _pwr(NULL), // pwr not needed so null it to be safe
+    _sce(new DigitalOut(PTB19)),
+    _rst(new DigitalOut(PTC1)),
+    _dc(new DigitalOut(PTB18)),
+    _dirty_tracking(false), // send the whole buffer by default
+    _refresh_bytes(0),
+    _span_count(0),
+    _busy(false)
+{
+    // nothing is dirty until the buffer is written to, as after a refresh
+    memset(_dirty_lo,WIDTH,sizeof(_dirty_lo));
+    memset(_dirty_hi,0,sizeof(_dirty_hi));
+
+#ifdef OVERDRAW_MODE
+    resetOverdraw();
+#endif
+}
+
+N5110::~N5110()
+{
+    waitForIdle();  // don't pull the SPI out from under a transfer
+    delete _spi;
+
+    if(_pwr) {
+        delete _pwr;
+    }
+
+    delete _led;
+    delete _sce;
+    delete _rst;
+    delete _dc;
+}
+
+// initialise function - powers up and sends the initialisation commands
+void N5110::init()
+{
+    turnOn();     // power up
+    reset();      // reset LCD - must be done within 100 ms
+    initSPI();    
+    
+    backLightOn();
+    setContrast(0.55);  // this may need tuning (say 0.4 to 0.6)
+    setBias(3);   // datasheet - 48:1 mux - don't mess with if you don't know what you're doing! (0 to 7)
+    setTempCoefficient(0); // datasheet - may need increasing (range 0 to 3) at very low temperatures
+    normalMode();  // normal video mode by default
+    
+    clearRAM();      // RAM is undefined at power-up so clear to be sure
+    clear();   // clear buffer
+}
+
+// sets normal video mode (black on white)
+void N5110::normalMode()
+{
+    sendCommand(0b00100000);   // basic instruction
+    sendCommand(0b00001100);  // normal video mode- datasheet
+}
+
+// sets normal video mode (white on black)
+void N5110::inverseMode()
+{
+    sendCommand(0b00100000);   // basic instruction
+    sendCommand(0b00001101);   // inverse video mode - datasheet
+}
+
+// function to power up the LCD and backlight - only works when using GPIO to power
+void N5110::turnOn()
+{
+    if (_pwr != NULL) {
+        _pwr->write(1);  // apply power
+    }
+}
+
+// function to power down LCD
+void N5110::turnOff()
+{
+    clear(); // clear buffer
+    refresh();
+    backLightOff(); // turn backlight off
+    clearRAM();   // clear RAM to ensure specified current consumption
+    // send command to ensure we are in basic mode
+    
+    sendCommand(0b00100000); // basic mode
+    sendCommand(0b00001000); // clear display
+    sendCommand(0b00100001); // extended mode
+    sendCommand(0b00100100); // power down
+    
+    // if we are powering the LCD using the GPIO then make it low to turn off
+    if (_pwr != NULL) {
+        wait_ms(10);  // small delay and then turn off the power pin
+        _pwr->write(0);  // turn off power
+    }
+
+}
+
+// function to change LED backlight brightness
+void N5110::backLightOn()
+{
+    _led->write(1);
+}
+
+// function to change LED backlight brightness
+void N5110::backLightOff()
+{
+    _led->write(0);
+}
+
+void N5110::setContrast(float contrast) {
+    
+    // enforce limits
+    if (contrast > 1.0f)
+        contrast = 1.0f;
+    else if (contrast < 0.0f)
+        contrast = 0.0;
+    
+    // convert to char in range 0 to 127 (i.e. 6 bits)
+    char ic = char(contrast*127.0f);
+    
+    sendCommand(0b00100001);  // extended instruction set
+    sendCommand(0b10000000 | ic);   // set Vop (which controls contrast)
+    sendCommand(0b00100000);  // back to basic instruction set
+}
+
+void N5110::setTempCoefficient(char tc) {
+    
+    // enforce limits
+    if (tc>3) {
+        tc=3;
+    }
+    
+    // temperature coefficient may need increasing at low temperatures
+
+    sendCommand(0b00100001);  // extended instruction set
+    sendCommand(0b00000100 | tc);
+    sendCommand(0b00100000);  // back to basic instruction set
+}
+    
+void N5110::setBias(char bias) {
+    
+    // from data sheet
+    // bias      mux rate
+    // 0        1:100
+    // 1        1:80
+    // 2        1:65
+    // 3        1:48   (default)
+    // 4        1:40/1:34
+    // 5        1:24
+    // 6        1:18/1:16
+    // 7        1:10/1:9/1:8
+    
+    // enforce limits
+    if (bias>7) {
+        bias=7;
+    }
+        
+    sendCommand(0b00100001);  // extended mode instruction
+    sendCommand(0b00010000 | bias);  
+    sendCommand(0b00100000); // end of extended mode instruction
+}
+
+// pulse the active low reset line
+void N5110::reset()
+{
+    _rst->write(0);  // reset the LCD
+    _rst->write(1);
+}
+
+// function to initialise SPI peripheral
+void N5110::initSPI()
+{
+    _spi->format(8,1);    // 8 bits, Mode 1 - polarity 0, phase 1 - base value of clock is 0, data captured on falling edge/propagated on rising edge
+    _spi->frequency(4000000);  // maximum of screen is 4 MHz
+}
+
+// send a command to the display
+void N5110::sendCommand(unsigned char command)
+{
+    waitForIdle();  // wait for any refresh to finish with the bus
+    _dc->write(0);  // set DC low for command
+    _sce->write(0); // set CE low to begin frame
+    _spi->write(command);  // send command
+    _dc->write(1);  // turn back to data by default
+    _sce->write(1); // set CE high to end frame (expected for transmission of single byte)
+}
+
+// send data to the display at the current XY address
+// dc is set to 1 (i.e. data) after sending a command and so should
+// be the default mode.
+void N5110::sendData(unsigned char data)
+{
+    waitForIdle();
+    _sce->write(0);   // set CE low to begin frame
+    _spi->write(data);
+    _sce->write(1);  // set CE high to end frame (expected for transmission of single byte)
+}
+
+// this function writes 0 to the 504 bytes to clear the RAM
+void N5110::clearRAM()
+{
+    waitForIdle();
+    _sce->write(0);  //set CE low to begin frame
+    for(int i = 0; i < WIDTH * HEIGHT; i++) { // 48 x 84 bits = 504 bytes
+        _spi->write(0x00);  // send 0's
+    }
+    _sce->write(1); // set CE high to end frame
+
+    memset(_front,0,sizeof(_front));  // display RAM is now known to be blank
+}
+
+// function to set the XY address in RAM for subsequenct data write
+void N5110::setXYAddress(unsigned int const x,
+                         unsigned int const y)
+{
+    if (x<WIDTH && y<HEIGHT) {  // check within range
+        sendCommand(0b00100000);  // basic instruction
+        sendCommand(0b10000000 | x);  // send addresses to display with relevant mask
+        sendCommand(0b01000000 | y);
+    }
+}
+
+// These functions are used to set, clear and get the value of pixels in the display
+// Pixels are addressed in the range of 0 to 47 (y) and 0 to 83 (x).  The refresh()
+// function must be called after set and clear in order to update the display
+void N5110::setPixel(unsigned int const x,
+                     unsigned int const y,
+                     bool const         state)
+{
+    if (x<WIDTH && y<HEIGHT) {  // check within range
+        // calculate bank and shift 1 to required position in the data byte
+        if(state) buffer[x][y/8] |= (1 << y%8);
+        else      buffer[x][y/8] &= ~(1 << y%8);
+        markDirty(x,x,y/8);
+        countWrites(x,x,y/8,1 << y%8);
+    }
+}
+
+void N5110::clearPixel(unsigned int const x,
+                       unsigned int const y)
+{
+    if (x<WIDTH && y<HEIGHT) {  // check within range
+        // calculate bank and shift 1 to required position (using bit clear)
+        buffer[x][y/8] &= ~(1 << y%8);
+        markDirty(x,x,y/8);
+        countWrites(x,x,y/8,1 << y%8);
+    }
+}
+
+int N5110::getPixel(unsigned int const x,
+                    unsigned int const y) const
+{
+    if (x<WIDTH && y<HEIGHT) {  // check within range
+        // return relevant bank and mask required bit
+
+        int pixel = (int) buffer[x][y/8] & (1 << y%8);
+
+        if (pixel)
+            return 1;
+        else
+            return 0;
+    }
+
+    return 0;
+
+}
+
+// function to refresh the display
+// the changed part of the back buffer is copied into the front buffer, which is then
+// streamed out in the background so that the next frame can be drawn in the meantime
+void N5110::refresh()
+{
+    PROFILE_ZONE(ZONE_REFRESH);
+    
+    waitForIdle();  // the front buffer can't change while it is still being sent
+    endOverdrawFrame();
+
+    _span_count = 0;
+    _refresh_bytes = 0;
+
+    if (_dirty_tracking) {
+        // only send the columns that differ from the display RAM, splitting
+        // into separate spans when the unchanged gap is worth a new address
+        for(int j = 0; j < BANKS; j++) {
+            int start = -1;  // first column of the current span
+            int last = -1;   // last changed column of the current span
+
+            for(int i = _dirty_lo[j]; i <= _dirty_hi[j]; i++) {
+                if (buffer[i][j] == _front[j][i])
+                    continue;
+
+                if (start >= 0 && i - last - 1 >= SPAN_GAP) {
+                    addSpan(start,j,last-start+1);
+                    start = -1;
+                }
+                if (start < 0)
+                    start = i;
+                last = i;
+            }
+
+            if (start >= 0)
+                addSpan(start,j,last-start+1);
+        }
+    } else {
+        // one span from 0,0 covering the whole display - the address auto increments
+        // across the banks in horizontal addressing mode
+        for(int j = 0; j < BANKS; j++) {  // be careful to use correct order (j,i) for horizontal addressing
+            for(int i = 0; i < WIDTH; i++) {
+                _front[j][i] = buffer[i][j];
+            }
+        }
+        _spans[0].x = 0;
+        _spans[0].bank = 0;
+        _spans[0].length = BANKS*WIDTH;
+        _span_count = 1;
+        _refresh_bytes = 3 + BANKS*WIDTH;  // address commands + whole buffer
+    }
+
+    // nothing is dirty until the buffer is written to again
+    memset(_dirty_lo,WIDTH,sizeof(_dirty_lo));
+    memset(_dirty_hi,0,sizeof(_dirty_hi));
+
+    if (_span_count > 0) {
+        startTransfer();
+    } else if (_refresh_done) {
+        _refresh_done.call();  // nothing changed so the display is already up to date
+    }
+}
+
+// copy one bank/column span of the back buffer into the front buffer and queue it
+void N5110::addSpan(unsigned int const x,
+                    unsigned int const bank,
+                    unsigned int const length)
+{
+    for(unsigned int i = x; i < x + length; i++) {
+        _front[bank][i] = buffer[i][bank];
+    }
+
+    _spans[_span_count].x = x;
+    _spans[_span_count].bank = bank;
+    _spans[_span_count].length = length;
+    _span_count++;
+
+    _refresh_bytes += 3 + length;  // address commands + data
+}
+
+// send the queued spans to the display
+void N5110::startTransfer()
+{
+    _busy = true;
+    _span_index = 0;
+    _sce->write(0);  //set CE low to begin frame - it stays low for every span
+
+#if DEVICE_SPI_ASYNCH
+    sendSpanAddress();
+#else
+    // no asynchronous SPI on this target so the spans are sent here
+    for(; _span_index < _span_count; _span_index++) {
+        RefreshSpan const &span = _spans[_span_index];
+
+        _dc->write(0);  // set DC low for the address commands
+        _spi->write(0b00100000);  // basic instruction
+        _spi->write(0b10000000 | span.x);
+        _spi->write(0b01000000 | span.bank);
+        _dc->write(1);  // back to data
+
+        for(int i = 0; i < span.length; i++) {
+            _spi->write(_front[span.bank][span.x + i]);
+        }
+    }
+    finishTransfer();
+#endif
+}
+
+#if DEVICE_SPI_ASYNCH
+// each span is sent as two chained transfers, the address commands and then
+// the data, with the next transfer started from the completion event of the last
+void N5110::sendSpanAddress()
+{
+    RefreshSpan const &span = _spans[_span_index];
+
+    _span_command[0] = 0b00100000;  // basic instruction
+    _span_command[1] = 0b10000000 | span.x;
+    _span_command[2] = 0b01000000 | span.bank;
+
+    _sending_data = false;
+    _dc->write(0);  // set DC low for the address commands
+    _spi->transfer(_span_command, 3, (unsigned char *)NULL, 0,
+                   callback(this,&N5110::transferEvent), SPI_EVENT_COMPLETE);
+}
+
+// called from the SPI interrupt when a transfer completes
+void N5110::transferEvent(int event)
+{
+    if (!_sending_data) {  // address is set, so send the span data
+        RefreshSpan const &span = _spans[_span_index];
+
+        _sending_data = true;
+        _dc->write(1);  // back to data
+        _spi->transfer(&_front[span.bank][span.x], span.length, (unsigned char *)NULL, 0,
+                       callback(this,&N5110::transferEvent), SPI_EVENT_COMPLETE);
+    } else if (++_span_index < _span_count) {
+        sendSpanAddress();
+    } else {
+        finishTransfer();
+    }
+}
+#endif
+
+void N5110::finishTransfer()
+{
+    _sce->write(1); // set CE high to end frame
+    _busy = false;
+
+    if (_refresh_done) {
+        _refresh_done.call();
+    }
+}
+
+void N5110::waitForIdle()
+{
+    while (_busy) {
+        wait_us(1);  // spin until the last span has been sent, the host model sends it from the wait calls
+    }
+}
+
+void N5110::attachRefreshDone(Callback<void()> func)
+{
+    _refresh_done = func;
+}
+
+void N5110::setDirtyTracking(bool const enable)
+{
+    _dirty_tracking = enable;
+}
+
+unsigned int N5110::getRefreshByteCount() const
+{
+    return _refresh_bytes;
+}
+
+// widen the dirty span of a bank to include columns x0 to x1
+void N5110::markDirty(unsigned int const x0,
+                      unsigned int const x1,
+                      unsigned int const bank)
+{
+    if (x0 < _dirty_lo[bank])
+        _dirty_lo[bank] = x0;
+    if (x1 > _dirty_hi[bank])
+        _dirty_hi[bank] = (x1 < WIDTH) ? x1 : WIDTH-1;
+}
+
+void N5110::markAllDirty()
+{
+    memset(_dirty_lo,0,sizeof(_dirty_lo));
+    memset(_dirty_hi,WIDTH-1,sizeof(_dirty_hi));
+}
+
+// fills the buffer with random bytes.  Can be used to test the display.
+// The rand() function isn't seeded so it probably creates the same pattern everytime
+void N5110::randomiseBuffer()
+{
+    int i,j;
+    for(j = 0; j < BANKS; j++) {  // be careful to use correct order (j,i) for horizontal addressing
+        for(i = 0; i < WIDTH; i++) {
+            buffer[i][j] = rand()%256;  // generate random byte
+        }
+    }
+    markAllDirty();
+    countScreenWrites();
+
+}
+
+// function to print 5x7 font
+void N5110::printChar(char const          c,
+                      unsigned int const  x,
+                      unsigned int const  y)
+{
+    if (y<BANKS) {  // check if printing in range of y banks
+
+        for (int i = 0; i < 5 ; i++ ) {
+            int pixel_x = x+i;
+            if (pixel_x > WIDTH-1)  // ensure pixel isn't outside the buffer size (0 - 83)
+                break;
+            buffer[pixel_x][y] = font5x7[(c - 32)*5 + i];
+            // array is offset by 32 relative to ASCII, each character is 5 pixels wide
+        }
+        if (x < WIDTH) {
+            markDirty(x,x+4,y);
+            countWrites(x,(x+4 < WIDTH) ? x+4 : WIDTH-1,y,0xFF);
+        }
+
+    }
+}
+
+// function to print string at specified position
+void N5110::printString(const char         *str,
+                        unsigned int const  x,
+                        unsigned int const  y)
+{
+    if (y<BANKS) {  // check if printing in range of y banks
+
+        int n = 0 ; // counter for number of characters in string
+        // loop through string and print character
+        while(*str) {
+
+            // writes the character bitmap data to the buffer, so that
+            // text and pixels can be displayed at the same time
+            for (int i = 0; i < 5 ; i++ ) {
+                int pixel_x = x+i+n*6;
+                if (pixel_x > WIDTH-1) // ensure pixel isn't outside the buffer size (0 - 83)
+                    break;
+                buffer[pixel_x][y] = font5x7[(*str - 32)*5 + i];
+            }
+            if (x+n*6 < WIDTH)
+                countWrites(x+n*6,(x+n*6+4 < WIDTH) ? x+n*6+4 : WIDTH-1,y,0xFF);
+            str++;  // go to next character in string
+            n++;    // increment index
+        }
+        if (n > 0 && x < WIDTH)
+            markDirty(x,x+n*6-2,y);  // last character ends 2 pixels before the next would start
+    }
+}
+
+// function to clear the screen buffer
+void N5110::clear()
+{
+    memset(buffer,0,sizeof(buffer));
+    markAllDirty();
+    countScreenWrites();
+}
+
+void N5110::saveBuffer(unsigned char layer[WIDTH][BANKS]) const
+{
+    memcpy(layer,buffer,sizeof(buffer));
+}
+
+void N5110::loadBuffer(unsigned char const layer[WIDTH][BANKS])
+{
+    memcpy(buffer,layer,sizeof(buffer));
+    markAllDirty();
+    countScreenWrites();
+}
+
+// function to plot array on display
+void N5110::plotArray(float const array[])
+{
+    for (int i=0; i<WIDTH; i++) {  // loop through array
+        // elements are normalised from 0.0 to 1.0, so multiply
+        // by 47 to convert to pixel range, and subtract from 47
+        // since top-left is 0,0 in the display geometry
+        setPixel(i,47 - int(array[i]*47.0f),true);
+    }
+
+}
+
+// function to draw circle
+void N5110:: drawCircle(unsigned int const x0,
+                        unsigned int const y0,
+                        unsigned int const radius,
+                        FillType const     fill)
+{
+    // from http://en.wikipedia.org/wiki/Midpoint_circle_algorithm
+    int x = radius;
+    int y = 0;
+    int radiusError = 1-x;
+
+    while(x >= y) {
+
+        // if transparent, just draw outline
+        if (fill == FILL_TRANSPARENT) {
+            setPixel( x + x0,  y + y0,true);
+            setPixel(-x + x0,  y + y0,true);
+            setPixel( y + x0,  x + y0,true);
+            setPixel(-y + x0,  x + y0,true);
+            setPixel(-y + x0, -x + y0,true);
+            setPixel( y + x0, -x + y0,true);
+            setPixel( x + x0, -y + y0,true);
+            setPixel(-x + x0, -y + y0,true);
+        } else {  // drawing filled circle, so draw lines between points at same y value
+
+            int type = (fill==FILL_BLACK) ? 1:0;  // black or white fill
+
+            drawLine(x+x0,y+y0,-x+x0,y+y0,type);
+            drawLine(y+x0,x+y0,-y+x0,x+y0,type);
+            drawLine(y+x0,-x+y0,-y+x0,-x+y0,type);
+            drawLine(x+x0,-y+y0,-x+x0,-y+y0,type);
+        }
+
+        y++;
+        if (radiusError<0) {
+            radiusError += 2 * y + 1;
+        } else {
+            x--;
+            radiusError += 2 * (y - x) + 1;
+        }
+    }
+
+}
+
+void N5110::drawLine(unsigned int const x0,
+                     unsigned int const y0,
+                     unsigned int const x1,
+                     unsigned int const y1,
+                     unsigned int const type)
+{
+    // Note that the ranges can be negative so we have to turn the input values
+    // into signed integers first
+    int const y_range = static_cast<int>(y1) - static_cast<int>(y0);
+    int const x_range = static_cast<int>(x1) - static_cast<int>(x0);
+
+    // if dotted line, set step to 2, else step is 1
+    unsigned int const step = (type==2) ? 2:1;
+
+    // make sure we loop over the largest range to get the most pixels on the display
+    // for instance, if drawing a vertical line (x_range = 0), we need to loop down the y pixels
+    // or else we'll only end up with 1 pixel in the x column
+    if ( abs(x_range) > abs(y_range) ) {
+
+        // ensure we loop from smallest to largest or else for-loop won't run as expected
+        unsigned int const start = x_range > 0 ? x0:x1;
+        unsigned int const stop =  x_range > 0 ? x1:x0;
+
+        // loop between x pixels
+        for (unsigned int x = start; x<= stop ; x+=step) {
+            // do linear interpolation
+            int const dx = static_cast<int>(x)-static_cast<int>(x0);
+            unsigned int const y = y0 + y_range * dx / x_range;
+
+            // If the line type is '0', this will clear the pixel
+            // If it is '1' or '2', the pixel will be set
+            setPixel(x,y, type);
+        }
+    } else {
+
+        // ensure we loop from smallest to largest or else for-loop won't run as expected
+        unsigned int const start = y_range > 0 ? y0:y1;
+        unsigned int const stop =  y_range > 0 ? y1:y0;
+
+        for (unsigned int y = start; y<= stop ; y+=step) {
+            // do linear interpolation
+            int const dy = static_cast<int>(y)-static_cast<int>(y0);
+            unsigned int const x = x0 + x_range * dy / y_range;
+
+            // If the line type is '0', this will clear the pixel
+            // If it is '1' or '2', the pixel will be set
+            setPixel(x,y, type);
+        }
+    }
+
+}
+
+void N5110::drawRect(unsigned int const x0,
+                     unsigned int const y0,
+                     unsigned int const width,
+                     unsigned int const height,
+                     FillType const     fill)
+{
+    if (fill == FILL_TRANSPARENT) { // transparent, just outline
+        drawLine(x0,y0,x0+(width-1),y0,1);  // top
+        drawLine(x0,y0+(height-1),x0+(width-1),y0+(height-1),1);  // bottom
+        drawLine(x0,y0,x0,y0+(height-1),1);  // left
+        drawLine(x0+(width-1),y0,x0+(width-1),y0+(height-1),1);  // right
+    } else { // filled rectangle, masked into each bank it covers
+        // clip to the screen, the origin can be negative
+        int const left = static_cast<int>(x0) > 0 ? static_cast<int>(x0) : 0;
+        int const top = static_cast<int>(y0) > 0 ? static_cast<int>(y0) : 0;
+        int const right = (static_cast<int>(x0 + width) < WIDTH) ? static_cast<int>(x0 + width) : WIDTH;  // one past the last column
+        int const bottom = (static_cast<int>(y0 + height) < HEIGHT) ? static_cast<int>(y0 + height) : HEIGHT;  // one past the last row
+        if (left >= right || top >= bottom)
+            return;
+
+        for (int bank = top/8; bank <= (bottom - 1)/8; bank++) {
+            int const first = (top > bank*8) ? top - bank*8 : 0;  // rows of the bank that are filled
+            int const last = (bottom < bank*8 + 8) ? bottom - bank*8 : 8;
+            unsigned char const mask = ((1u << last) - 1) & ~((1u << first) - 1);
+
+            for (int x = left; x < right; x++) {
+                if (fill == FILL_BLACK) buffer[x][bank] |= mask;
+                else                    buffer[x][bank] &= ~mask;
+            }
+            markDirty(left,right - 1,bank);
+            countWrites(left,right - 1,bank,mask);
+        }
+    }
+}
+
+void N5110::drawSprite(int x0,
+                       int y0,
+                       int nrows,
+                       int ncols,
+                       int *sprite)
+{
+    for (int i = 0; i < nrows; i++) {
+        for (int j = 0 ; j < ncols ; j++) {
+
+            int pixel = *((sprite+i*ncols)+j);
+            setPixel(x0+j,y0+i, pixel);
+        }
+    }
+}
+
+// bit 0 swapped with bit 7, 1 with 6 and so on
+static inline unsigned char reverseBits(unsigned char b)
+{
+    b = (b >> 4) | (b << 4);
+    b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
+    return ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
+}
+
+unsigned char N5110::flippedColumn(PackedSprite const &sprite,
+                                   int page,
+                                   int col,
+                                   int flip)
+{
+    if (flip & FLIP_X)
+        col = sprite.width - 1 - col;
+
+    if (!(flip & FLIP_Y))
+        return sprite.data[page*sprite.width + col];
+
+    // row r comes from row height-1-r: reversing a byte of the bottom page
+    // puts its last row on bit 7, so it's shifted down by the unused rows and
+    // topped up from the page above
+    int const pages = (sprite.height + 7)/8;
+    int const unused = pages*8 - sprite.height;
+    int const src = pages - 1 - page;
+
+    unsigned int bits = reverseBits(sprite.data[src*sprite.width + col]) >> unused;
+    if (src > 0)
+        bits |= reverseBits(sprite.data[(src - 1)*sprite.width + col]) << (8 - unused);
+    return bits;
+}
+
+void N5110::drawPackedSprite(int x0,
+                             int y0,
+                             PackedSprite const &sprite,
+                             int flip)
+{
+    // clip the columns to the screen
+    int const first = (x0 < 0) ? -x0 : 0;
+    int const last = (x0 + sprite.width > WIDTH) ? WIDTH - x0 : sprite.width;
+    if (first >= last)
+        return;
+
+    // bank of the top row, and how far down that bank it starts (rounding down for y0 < 0)
+    int const top_bank = (y0 >= 0) ? y0/8 : -((7 - y0)/8);
+    int const shift = y0 - top_bank*8;
+
+    int const pages = (sprite.height + 7)/8;
+
+    for (int page = 0; page < pages; page++) {
+        int const rows = (sprite.height - page*8 < 8) ? sprite.height - page*8 : 8;
+
+        // the page covers these bits once shifted, split over two banks
+        unsigned int const mask = ((1u << rows) - 1) << shift;
+        unsigned char const upper_mask = mask & 0xFF;
+        unsigned char const lower_mask = mask >> 8;
+
+        int const bank = top_bank + page;
+        bool const upper = bank >= 0 && bank < BANKS && upper_mask;
+        bool const lower = bank + 1 >= 0 && bank + 1 < BANKS && lower_mask;
+
+        // mirrored left to right is the same page read backwards
+        unsigned char const *column = sprite.data + page*sprite.width;
+        int step = 1;
+        if (flip & FLIP_X) {
+            column += sprite.width - 1;
+            step = -1;
+        }
+
+        for (int i = first; i < last; i++) {
+            unsigned int const bits = ((flip & FLIP_Y) ? flippedColumn(sprite, page, i, flip) : column[i*step]) << shift;
+            int const x = x0 + i;
+
+            if (upper)
+                buffer[x][bank] = (buffer[x][bank] & ~upper_mask) | (bits & upper_mask);
+            if (lower)
+                buffer[x][bank+1] = (buffer[x][bank+1] & ~lower_mask) | ((bits >> 8) & lower_mask);
+        }
+
+        if (upper) {
+            markDirty(x0 + first,x0 + last - 1,bank);
+            countWrites(x0 + first,x0 + last - 1,bank,upper_mask);
+        }
+        if (lower) {
+            markDirty(x0 + first,x0 + last - 1,bank + 1);
+            countWrites(x0 + first,x0 + last - 1,bank + 1,lower_mask);
+        }
+    }
+}
+
+void N5110::drawTileMap(TileMap const &map)
+{
+    for (int bank = 0; bank < BANKS; bank++) {
+        TileStrip const &top = map.strips[map.rows[bank*2]];
+        TileStrip const &bottom = map.strips[map.rows[bank*2 + 1]];
+        int t = 0; // index in the top strip
+        int b = 0; // and in the bottom one
+
+        for (int x = 0; x < WIDTH; x += TILE_SIZE) {
+            unsigned int upper = map.tiles[top.tiles[t]];
+            unsigned int lower = map.tiles[bottom.tiles[b]];
+
+            for (int i = 0; i < TILE_SIZE; i++) {
+                buffer[x + i][bank] = (upper & 0x0F) | ((lower & 0x0F) << 4);
+                upper >>= 4;
+                lower >>= 4;
+            }
+
+            if (++t == top.period)
+                t = 0;
+            if (++b == bottom.period)
+                b = 0;
+        }
+    }
+    markAllDirty();
+    countScreenWrites();
+}
+
+void N5110::drawStrip(int y0,
+                      int height,
+                      unsigned char const *columns,
+                      int length,
+                      int start)
+{
+    int const top_bank = (y0 >= 0) ? y0/8 : -((7 - y0)/8);
+    int const shift = y0 - top_bank*8;
+
+    unsigned int const mask = ((1u << height) - 1) << shift;
+    unsigned char const upper_mask = mask & 0xFF;
+    unsigned char const lower_mask = mask >> 8;
+
+    bool const upper = top_bank >= 0 && top_bank < BANKS && upper_mask;
+    bool const lower = top_bank + 1 >= 0 && top_bank + 1 < BANKS && lower_mask;
+
+    // the window is the end of the strip then its start, as many times as it
+    // takes, each run copied without checking for the wrap
+    unsigned char const *src = columns + start;
+    int run = length - start;
+
+    for (int x = 0; x < WIDTH; x += run, src = columns, run = length) {
+        if (run > WIDTH - x)
+            run = WIDTH - x;
+
+        if (upper && !lower) {
+            // the usual case, the rows are all in one bank
+            for (int i = 0; i < run; i++)
+                buffer[x+i][top_bank] = (buffer[x+i][top_bank] & ~upper_mask) | ((src[i] << shift) & upper_mask);
+            continue;
+        }
+
+        for (int i = 0; i < run; i++) {
+            unsigned int const bits = src[i] << shift;
+
+            if (upper)
+                buffer[x+i][top_bank] = (buffer[x+i][top_bank] & ~upper_mask) | (bits & upper_mask);
+            if (lower)
+                buffer[x+i][top_bank+1] = (buffer[x+i][top_bank+1] & ~lower_mask) | ((bits >> 8) & lower_mask);
+        }
+    }
+
+    if (upper) {
+        markDirty(0,WIDTH - 1,top_bank);
+        countWrites(0,WIDTH - 1,top_bank,upper_mask);
+    }
+    if (lower) {
+        markDirty(0,WIDTH - 1,top_bank + 1);
+        countWrites(0,WIDTH - 1,top_bank + 1,lower_mask);
+    }
+}
+
+void N5110::packSprite(int const *sprite,
+                       int nrows,
+                       int ncols,
+                       unsigned char *data)
+{
+    int const pages = (nrows + 7)/8;
+
+    for (int page = 0; page < pages; page++) {
+        for (int j = 0; j < ncols; j++) {
+            unsigned char bits = 0;
+
+            for (int bit = 0; bit < 8 && page*8 + bit < nrows; bit++) {
+                if (*((sprite+(page*8 + bit)*ncols)+j))
+                    bits |= (1 << bit);
+            }
+            data[page*ncols + j] = bits;
+        }
+    }
+}
+
+#ifdef OVERDRAW_MODE
+
+char const *N5110::setOverdrawSite(char const *site)
+{
+    char const *previous = _site;
+    _site = site;
+    return previous;
+}
+
+void N5110::resetOverdraw()
+{
+    memset(_written,0,sizeof(_written));
+    memset(_heat,0,sizeof(_heat));
+    memset(_sites,0,sizeof(_sites));
+    _site_count = 0;
+    _site = NULL;
+    _frames = 0;
+    _covered = 0;
+}
+
+// count the pixels of mask in columns x0 to x1 of a bank as written by the
+// current site, any of them already written this frame as overdrawn
+void N5110::countWrites(int const x0,
+                        int const x1,
+                        int const bank,
+                        unsigned char const mask)
+{
+    char const *name = _site ? _site : "(no site)";
+
+    // sites are looked up by name, the table is small and this is a debug build
+    int s = 0;
+    while (s < _site_count && strcmp(_sites[s].name,name) != 0)
+        s++;
+    if (s == _site_count) {
+        if (_site_count == OVERDRAW_SITES) {
+            s = OVERDRAW_SITES - 1;
+            _sites[s].name = "(other sites)";
+        } else {
+            _sites[s].name = name;
+            _site_count++;
+        }
+    }
+
+    int const bits = __builtin_popcount(mask);
+    for (int x = x0; x <= x1; x++) {
+        _sites[s].writes += bits;
+        _sites[s].overdrawn += __builtin_popcount(mask & _written[x][bank]);
+        _written[x][bank] |= mask;
+
+        for (int bit = 0; bit < 8; bit++) {
+            if (mask & (1 << bit))
+                _heat[x][bank*8 + bit]++;
+        }
+    }
+}
+
+void N5110::countScreenWrites()
+{
+    for (int bank = 0; bank < BANKS; bank++)
+        countWrites(0,WIDTH - 1,bank,0xFF);
+}
+
+// the pixels written since the last refresh were one frame
+void N5110::endOverdrawFrame()
+{
+    for (int i = 0; i < WIDTH; i++) {
+        for (int j = 0; j < BANKS; j++)
+            _covered += __builtin_popcount(_written[i][j]);
+    }
+    memset(_written,0,sizeof(_written));
+    _frames++;
+}
+
+void N5110::dumpOverdraw() const
+{
+    if (_frames == 0) {
+        printf("overdraw: no frames refreshed yet\n");
+        return;
+    }
+
+    unsigned long writes = 0;
+    for (int s = 0; s < _site_count; s++)
+        writes += _sites[s].writes;
+
+    float const frames = _frames;
+    printf("overdraw over %lu frames\n", _frames);
+    printf("%-18s %9.1f\n", "writes/frame", writes/frames);
+    printf("%-18s %9.1f\n", "covered/frame", _covered/frames);
+    printf("%-18s %9.2f\n", "overdraw ratio", _covered ? (float)writes/_covered : 0.0f);
+
+    printf("%-18s %9s %9s %6s\n", "site (px/frame)", "writes", "overdrawn", "%");
+    for (int s = 0; s < _site_count; s++) {
+        printf("%-18s %9.1f %9.1f %5.1f%%\n",
+               _sites[s].name,
+               _sites[s].writes/frames,
+               _sites[s].overdrawn/frames,
+               _sites[s].writes ? 100.0f*_sites[s].overdrawn/_sites[s].writes : 0.0f);
+    }
+
+    // one character per pixel, by its mean writes per frame rounded
+    static char const shades[] = " .:-=+*#%@";
+    printf("heatmap, writes/frame per pixel: ' ' 0, '.' 1, ':' 2 ... '@' 9 or more\n");
+    for (int y = 0; y < HEIGHT; y++) {
+        char row[WIDTH + 1];
+        for (int x = 0; x < WIDTH; x++) {
+            unsigned long const mean = (_heat[x][y] + _frames/2)/_frames;
+            row[x] = shades[mean < 9 ? mean : 9];
+        }
+        row[WIDTH] = '\0';
+        printf("|%s|\n", row);
+    }
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+#define FIXED_FRAC_BITS 8 // 1/256 of a pixel
+
+/** Fixed Class
+ *
+ * @brief Q23.8 fixed point number for positions, speeds and rectangles. Adding
+ * @brief and comparing are plain integer operations, so motion is exact and the
+ * @brief same on every run and every target. Whole pixels convert implicitly;
+ * @brief floats don't, so they can't sneak into the hot path. Use fromFloat()
+ * @brief for constants, where it is worked out at compile time.
+ */
+class Fixed
+{
+    public:
+        /** Constructor, zero */
+        constexpr Fixed() : raw(0) {}
+        
+        /** Constructor
+         * @param pixels - whole pixels
+         */
+        constexpr Fixed(int pixels) : raw(pixels * (1 << FIXED_FRAC_BITS)) {}
+        
+        Fixed(float) = delete;
+        Fixed(double) = delete;
+        
+        /** @brief value from its raw Q23.8 representation
+         */
+        static constexpr Fixed fromRaw(int32_t raw)
+        {
+            return Fixed(raw, 0);
+        }
+        
+        /** @brief nearest value to a float constant, for tables like the velocity table
+         */
+        static constexpr Fixed fromFloat(float value)
+        {
+            return Fixed((int32_t)(value * (1 << FIXED_FRAC_BITS) + (value < 0 ? -0.5f : 0.5f)), 0);
+        }
+        
+        /** @brief whole pixels, rounded down (towards the left/top of the screen)
+         */
+        constexpr int toInt() const
+        {
+            return raw >> FIXED_FRAC_BITS;
+        }
+        
+        /** @brief value as a float, for printing only
+         */
+        constexpr float toFloat() const
+        {
+            return raw / (float)(1 << FIXED_FRAC_BITS);
+        }
+        
+        Fixed &operator+=(Fixed b) { raw += b.raw; return *this; }
+        Fixed &operator-=(Fixed b) { raw -= b.raw; return *this; }
+        
+        /** @brief value in 1/256 pixels
+         */
+        int32_t raw;
+        
+    private:
+        constexpr Fixed(int32_t raw, int) : raw(raw) {}
+};
+
+constexpr Fixed operator+(Fixed a, Fixed b) { return Fixed::fromRaw(a.raw + b.raw); }
+constexpr Fixed operator-(Fixed a, Fixed b) { return Fixed::fromRaw(a.raw - b.raw); }
+constexpr Fixed operator-(Fixed a) { return Fixed::fromRaw(-a.raw); }
+
+constexpr bool operator==(Fixed a, Fixed b) { return a.raw == b.raw; }
+constexpr bool operator!=(Fixed a, Fixed b) { return a.raw != b.raw; }
+constexpr bool operator<(Fixed a, Fixed b) { return a.raw < b.raw; }
+constexpr bool operator>(Fixed a, Fixed b) { return a.raw > b.raw; }
+constexpr bool operator<=(Fixed a, Fixed b) { return a.raw <= b.raw; }
+constexpr bool operator>=(Fixed a, Fixed b) { return a.raw >= b.raw; }
+
+#endif
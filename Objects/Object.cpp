@@ -1,197 +1,140 @@
-#include "Object.h"
-#include "Frogger.h"
-
-Object::Object()
-{  
-    initializeLogParameters();
-    initializeScreenParameters();
-}
-
-void Object::initializeScreenParameters()
-{
-    screenHeight = 48;
-    screenWidth = 84;
-    grid = 4;
-}
-
-void Object::initializeLogParameters()
-{
-    size = 3;  
-    seperation = 0;  
-   
-    //different speeds of vehicles
-    slow = 0.4;
-    medium = 0.6;
-    fast = 0.8;
-}
-
-void Object::setDir(int dir)
-{
-    this->object.dir = dir; 
-    
-    //printf("print current object direction %d", this->object.dir);
-}
-
-void Object::setRow(int row)
-{
-    this->row = row;
-   
-    // y position of all vehicles
-    object.y = screenHeight - grid * row;
-    //printf("print current object y %d", this->object.y);
-
-}
-
-void Object::setSeperation(int seperate)
-{
-    this->seperation = seperate;
-   
-    // intialize the vehicle size and position in lcd
-    // x position of all vehicles
-    object.x = seperation;
-}
-
-void Object::speedSlow(int dir)
-{
-    this->speed = 0.4;
-
-    switch(dir)
-    {
-        case 1:
-            object.x += 0.4;
-            updateRect(object.x, object.y);
-            break;
-        case 2:
-            object.x -= 0.4;
-            updateRect(object.x, object.y);
-            break;
-    }
-    
-    //printf("check if rect is updated %d", this->rectangle.left_side, 
-    //this->rectangle.right_side);
-}
-
-void Object::speedMedium(int dir)
-{ 
-    this->speed = 0.6;
-    
-    switch(dir)
-    {
-        case 1:
-            object.x += 0.6;
-            updateRect(object.x, object.y);
-            break;
-        case 2:
-            object.x -= 0.6;
-            updateRect(object.x, object.y);
-            break;
-    }
-}
-
-void Object::speedFast(int dir)
-{   
-    this->speed = 0.9;
-    
-    switch(dir)
-    {
-        case 1:
-            object.x += 0.9;
-            updateRect(object.x, object.y);
-            break;
-        case 2:
-            object.x -= 0.9;
-            updateRect(object.x, object.y);
-            break;
-    }
-}
-
-void Object::speedUltra(int dir)
-{   
-    this->speed = 1.3;
-
-    switch(dir)
-    {
-        case 1:
-            object.x += 1.3;
-            updateRect(object.x, object.y);
-            break;
-        case 2:
-            object.x -= 1.3;
-            updateRect(object.x, object.y);
-            break;
-    }
-}
-
-void Object::setSprite(char c)
-{
-    this->object.c = c;  // used to determine the sprite 
-
-    if(c == 'T' || c == 'M' || c == 'G') {
-        determineLogRecParamaters(c); // create a rectangle for logs
-    } else if(c == 'S') {
-        determineBonusVehiclesRec(c);
-    } else {
-        determineVehicleRecParamaters(c); // create a rectangle for vehicles
-    }
-}
-
-void Object::determineVehicleRecParamaters(char c)
-{
-    switch(c)
-    {
-        case 'R':
-            createRect(12, 4);
-            break;
-        case 'L':
-            createRect(12, 4);
-            break;
-        case 'N':
-            createRect(10, 4);
-            break;
-        case 'X':
-            createRect(10, 4);
-            break;
-        case 'B':
-            createRect(16, 4);
-            break;
-    }
-}
-
-void Object::determineLogRecParamaters(char c)
-{
-    switch(c)
-    {
-        case 'M':
-            createRect(16, 4);
-            break;
-        case 'T':  
-            createRect(12, 4);
-            break;
-        case 'G':
-            createRect(20, 4);
-            break;
-    }  
-}
-
-void Object::determineBonusVehiclesRec(char c)
-{
-    createRect(4, 12);
-}
-
-void Object::createRect(int width, int height)
-{
-    this->width = width;
-    this->height = height;
-    this->rectangle.left_side = object.x;
-    this->rectangle.right_side = object.x + width;
-    this->rectangle.bottom = height + object.y;
-    this->rectangle.up = object.y;
-}
-
-void Object::updateRect(int x, int y)
-{
-    this->rectangle.left_side = object.x;
-    this->rectangle.right_side = object.x + this->width;
-    this->rectangle.bottom = this->height + object.y;
-    this->rectangle.up = object.y;
+#include "Object.h"
+#include "Frogger.h"
+
+// pixels per frame of each speed class, rounded to the nearest 1/256
+const Fixed object_velocity[SPEED_CLASSES] = {
+    Fixed::fromFloat(0.4f), // slow
+    Fixed::fromFloat(0.6f), // medium
+    Fixed::fromFloat(0.9f), // fast
+    Fixed::fromFloat(1.3f), // ultra
+};
+
+Object::Object()
+{  
+    initializeLogParameters();
+    initializeScreenParameters();
+}
+
+void Object::initializeScreenParameters()
+{
+    screenHeight = 48;
+    screenWidth = 84;
+    grid = 4;
+}
+
+void Object::initializeLogParameters()
+{
+    size = 3;  
+    seperation = 0;  
+    speed = 0;
+    width = 0;
+    height = 0;
+}
+
+void Object::setDir(int dir)
+{
+    this->object.dir = dir; 
+    
+    //printf("print current object direction %d", this->object.dir);
+}
+
+void Object::setRow(int row)
+{
+    this->row = row;
+   
+    // y position of all vehicles
+    object.y = screenHeight - grid * row;
+    //printf("print current object y %d", this->object.y);
+
+}
+
+void Object::setSeperation(int seperate)
+{
+    this->seperation = seperate;
+   
+    // intialize the vehicle size and position in lcd
+    // x position of all vehicles
+    object.x = seperation;
+}
+
+void Object::move(int speed_class, int dir)
+{
+    this->speed = object_velocity[speed_class];
+
+    switch(dir)
+    {
+        case 1:
+            object.x += speed;
+            break;
+        case 2:
+            object.x -= speed;
+            break;
+        default:
+            return;
+    }
+    
+    // only x has changed, so only the sides of the rectangle move
+    rectangle.left_side = object.x;
+    rectangle.right_side = object.x + width;
+}
+
+void Object::speedSlow(int dir)
+{
+    move(SPEED_SLOW, dir);
+}
+
+void Object::speedMedium(int dir)
+{ 
+    move(SPEED_MEDIUM, dir);
+}
+
+void Object::speedFast(int dir)
+{   
+    move(SPEED_FAST, dir);
+}
+
+void Object::speedUltra(int dir)
+{   
+    move(SPEED_ULTRA, dir);
+}
+
+void objectSize(char c, int &width, int &height)
+{
+    // the rectangle is the bounding box of the sprite
+    const PackedSprite *sprite = GraphicEngine::objectSprite(c); // first frame of the animated ones
+    
+    width = sprite ? sprite->width : 0;
+    height = sprite ? sprite->height : 0;
+}
+
+int objectFlip(char c, int dir)
+{
+    return GraphicEngine::objectFlip(c, dir);
+}
+
+void Object::setSprite(char c)
+{
+    this->object.c = c;  // used to determine the sprite 
+    
+    int width, height;
+    objectSize(c, width, height);
+    createRect(width, height); // rectangle for collision detection
+}
+
+void Object::createRect(int width, int height)
+{
+    this->width = width;
+    this->height = height;
+    this->rectangle.left_side = object.x;
+    this->rectangle.right_side = object.x + width;
+    this->rectangle.bottom = height + object.y;
+    this->rectangle.up = object.y;
+}
+
+void Object::updateRect(int x, int y)
+{
+    this->rectangle.left_side = object.x;
+    this->rectangle.right_side = object.x + this->width;
+    this->rectangle.bottom = this->height + object.y;
+    this->rectangle.up = object.y;
 }
\ No newline at end of file
@@ -1,169 +1,178 @@
-#ifndef OBJECT_H
-#define OBJECT_H
-
-/** stores the object position */
-struct ObjectInfo
-{
-    float x; /**< float for x value */
-    int y; /**< int for y value */
-    int dir; /**< int for direction value */
-    char c; /**< sprite */
-};
-
-/** stores the rectangle of object */
-struct Rect
-{
-    float right_side; /**< right side */
-    float left_side; /**< left side */
-    float up; /**< up */
-    float bottom; /**< bottom */
-}; 
-
-/** Object Class
- *
- * @brief builds the vehicles and logs and the end posts
- * @author Tarek Bessalah
- * @date May, 2020
- */
-class Object
-{
-    public:
-    
-        /** Constructor */
-        Object();
-        
-        /** @brief holds the speed of a slow object (0.4)
-         */        
-        int slow;
-        
-        /** @brief holds the speed of a medium pace object (0.6)
-         */
-        int medium;
-        
-        /** @brief holds the speed of a fast pace object (0.8)
-         */
-        int fast;
-        
-        /** @brief holds the current row number og object
-         */
-        int row;
-        
-        /** @brief holds the value of seperation
-         */
-        int seperation;
-        
-        /** @brief size of grid
-         */
-        int grid;
-        
-        /** @brief size of lcd width
-         */
-        int size;
-        
-        /** @brief current speed
-         */
-        float speed;
-        
-        /** @brief width of the screen
-         */
-        float width;
-        
-        /** @brief height of the screen
-         */
-        float height;
-        
-        /** @brief screen width in grid units
-         */
-        int screenWidth;
-        
-        /** @brief screen height in grid units
-         */
-        int screenHeight;
-        
-        /** @brief objectinfo struct object
-         */ 
-        ObjectInfo object;
-        
-        /** @brief rectangle struct object
-         */
-        Rect rectangle;
-            
-    public:
-    
-        /** @brief screen width in grid units
-         *  @param row - sets the row of the object
-         */
-        void setRow(int row);
-        
-        /** @brief sets the y values
-         *  @param seperation - sets distance between objects in row
-         */
-        void setSeperation(int seperation);
-        
-        /**
-         *  @param type - sets the sprite object
-         */
-        void setSprite(char type);
-        
-        /** @brief update the rect parameters after change of speed
-         *  @param c - set the sprite
-         */
-        void determineVehicleRecParamaters(char c);
-        
-        /** @brief update the rect parameters after change of speed
-         *  @param x - set the x pos
-         *  @param y - set the y pos 
-         */
-        void updateRect(int x, int y);
-        
-        /** @brief create the rectangle of object
-         *  @param x - set the x pos
-         *  @param y - set the y pos 
-         */
-        void createRect(int x, int y);
-        
-        /** @brief creates a rectangle
-         *  @param c - sets the sprite objects
-         */
-        void determineLogRecParamaters(char c);
-        
-        /** @brief ssets the rectangle parameters for collision detection
-         *  @param c - sets the sprites
-         */
-        void determineBonusVehiclesRec(char c);
-        
-        /** @brief sets the direction of the vehicle
-         *  @param dir - should be either 1 or 2 
-         */
-        void setDir(int dir);
-
-        /** @brief increases the x pos by 0.4 
-         *  @param dir - sets the direction of the object
-         */
-        void speedSlow(int dir);
-        
-        /** @brief increases the x pos by 0.6 
-         *  @param dir - sets the direction of the object
-         */
-        void speedMedium(int dir);
-        
-        /** @brief increases the x pos by 0.8 
-         *  @param dir - sets the direction of the object
-         */
-        void speedFast(int dir);
-        
-        /** @brief increases the x pos by 1.3 (ultra speed)
-         *  @param dir - sets the direction of the object
-         */
-        void speedUltra(int dir);
-
-        /** @brief set the log values
-         */
-        void initializeLogParameters();
-        
-        /** @brief set the screen width, height to a value
-         */
-        void initializeScreenParameters();
-};
-
+#ifndef OBJECT_H
+#define OBJECT_H
+
+#include "Fixed.h"
+
+/** speed classes, each has a fixed velocity in the table in Object.cpp */
+enum SpeedClass
+{
+    SPEED_SLOW,   /**< 0.4 pixels per frame */
+    SPEED_MEDIUM, /**< 0.6 pixels per frame */
+    SPEED_FAST,   /**< 0.9 pixels per frame */
+    SPEED_ULTRA,  /**< 1.3 pixels per frame */
+    SPEED_CLASSES
+};
+
+/** pixels per frame of each speed class, indexed by SpeedClass */
+extern const Fixed object_velocity[SPEED_CLASSES];
+
+/** @brief size of the collision rectangle of a sprite, its bounding box
+ *  @param c - sprite
+ *  @param width - set to the width of the rectangle
+ *  @param height - set to the height of the rectangle
+ */
+void objectSize(char c, int &width, int &height);
+
+/** @brief mirroring of a sprite moving in a direction, the vehicles face the way they go
+ *  @param c - sprite
+ *  @param dir - 1 (right) or 2 (left)
+ *  @returns SpriteFlip flags
+ */
+int objectFlip(char c, int dir);
+
+/** stores the object position */
+struct ObjectInfo
+{
+    Fixed x; /**< fixed point x value, moves by fractions of a pixel */
+    int y; /**< int for y value */
+    int dir; /**< int for direction value */
+    char c; /**< sprite */
+};
+
+/** stores the rectangle of object */
+struct Rect
+{
+    Fixed right_side; /**< right side */
+    Fixed left_side; /**< left side */
+    Fixed up; /**< up */
+    Fixed bottom; /**< bottom */
+}; 
+
+/** Object Class
+ *
+ * @brief builds the vehicles and logs and the end posts
+ * @author Tarek Bessalah
+ * @date May, 2020
+ */
+class Object
+{
+    public:
+    
+        /** Constructor */
+        Object();
+        
+        /** @brief holds the current row number og object
+         */
+        int row;
+        
+        /** @brief holds the value of seperation
+         */
+        int seperation;
+        
+        /** @brief size of grid
+         */
+        int grid;
+        
+        /** @brief size of lcd width
+         */
+        int size;
+        
+        /** @brief current speed, in pixels per frame
+         */
+        Fixed speed;
+        
+        /** @brief width of the object's rectangle
+         */
+        int width;
+        
+        /** @brief height of the object's rectangle
+         */
+        int height;
+        
+        /** @brief screen width in grid units
+         */
+        int screenWidth;
+        
+        /** @brief screen height in grid units
+         */
+        int screenHeight;
+        
+        /** @brief objectinfo struct object
+         */ 
+        ObjectInfo object;
+        
+        /** @brief rectangle struct object
+         */
+        Rect rectangle;
+            
+    public:
+    
+        /** @brief screen width in grid units
+         *  @param row - sets the row of the object
+         */
+        void setRow(int row);
+        
+        /** @brief sets the y values
+         *  @param seperation - sets distance between objects in row
+         */
+        void setSeperation(int seperation);
+        
+        /**
+         *  @param type - sets the sprite object
+         */
+        void setSprite(char type);
+        
+        /** @brief update the rect parameters after change of speed
+         *  @param x - set the x pos
+         *  @param y - set the y pos 
+         */
+        void updateRect(int x, int y);
+        
+        /** @brief create the rectangle of object
+         *  @param x - set the x pos
+         *  @param y - set the y pos 
+         */
+        void createRect(int x, int y);
+        
+        /** @brief sets the direction of the vehicle
+         *  @param dir - should be either 1 or 2 
+         */
+        void setDir(int dir);
+
+        /** @brief moves the object by the velocity of its speed class and
+         *  @brief updates the sides of its rectangle (y doesn't change)
+         *  @param speed_class - a SpeedClass
+         *  @param dir - sets the direction of the object
+         */
+        void move(int speed_class, int dir);
+
+        /** @brief increases the x pos by 0.4 
+         *  @param dir - sets the direction of the object
+         */
+        void speedSlow(int dir);
+        
+        /** @brief increases the x pos by 0.6 
+         *  @param dir - sets the direction of the object
+         */
+        void speedMedium(int dir);
+        
+        /** @brief increases the x pos by 0.9 
+         *  @param dir - sets the direction of the object
+         */
+        void speedFast(int dir);
+        
+        /** @brief increases the x pos by 1.3 (ultra speed)
+         *  @param dir - sets the direction of the object
+         */
+        void speedUltra(int dir);
+
+        /** @brief set the log values
+         */
+        void initializeLogParameters();
+        
+        /** @brief set the screen width, height to a value
+         */
+        void initializeScreenParameters();
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "Profiler.h"
+
+#ifdef PROFILER_MODE
+
+#ifndef __CORTEX_M
+#include <chrono>
+#endif
+
+static ZoneStats zones[ZONE_COUNT];
+
+static const char *zone_names[ZONE_COUNT] = {
+    "run",
+    "runCurrentLevel",
+    "LaneTable::update",
+    "checkCollisions",
+    "showLane",
+    "refresh",
+};
+
+ProfileScope *ProfileScope::_current = NULL;
+
+// log-linear bucket, the top bit picks the power of two and the two
+// bits under it pick one of PROFILE_HISTOGRAM_SUB steps within it
+static int bucket(uint32_t ticks)
+{
+    if (ticks < PROFILE_HISTOGRAM_SUB) {
+        return ticks;
+    }
+    int top = 31 - __builtin_clz(ticks);
+    int sub = (ticks >> (top - 2)) & (PROFILE_HISTOGRAM_SUB - 1);
+    return (top - 1)*PROFILE_HISTOGRAM_SUB + sub;
+}
+
+// smallest value that falls in a bucket
+static uint32_t bucketFloor(int b)
+{
+    if (b < PROFILE_HISTOGRAM_SUB) {
+        return b;
+    }
+    int top = b/PROFILE_HISTOGRAM_SUB + 1;
+    int sub = b%PROFILE_HISTOGRAM_SUB;
+    return (uint32_t)(PROFILE_HISTOGRAM_SUB + sub) << (top - 2);
+}
+
+static uint32_t percentile(const ZoneStats &z, int percent)
+{
+    uint32_t target = (uint32_t)(((uint64_t)z.count*percent + 99)/100);
+    uint32_t seen = 0;
+    for (int b = 0; b < PROFILE_HISTOGRAM_SIZE; b++) {
+        seen += z.histogram[b];
+        if (seen >= target) {
+            // top of the bucket, kept inside what was actually measured
+            uint32_t value = b + 1 < PROFILE_HISTOGRAM_SIZE ? bucketFloor(b + 1) - 1 : z.max;
+            if (value > z.max) value = z.max;
+            if (value < z.min) value = z.min;
+            return value;
+        }
+    }
+    return z.max;
+}
+
+static float ticksPerUs()
+{
+#ifdef __CORTEX_M
+    return SystemCoreClock/1000000.0f;
+#else
+    return 1000.0f;  // steady_clock counted in ns
+#endif
+}
+
+void Profiler::init()
+{
+#ifdef __CORTEX_M
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;  // enable the trace unit
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;  // start the cycle counter
+#endif
+    reset();
+}
+
+void Profiler::reset()
+{
+    memset(zones,0,sizeof(zones));
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        zones[i].min = 0xFFFFFFFF;
+        zones[i].parent = -2;  // not seen yet
+    }
+}
+
+uint32_t Profiler::now()
+{
+#ifdef __CORTEX_M
+    return DWT->CYCCNT;
+#else
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void Profiler::record(int zone, int parent, uint32_t ticks, uint32_t self)
+{
+    ZoneStats &z = zones[zone];
+    if (z.parent == -2) {
+        z.parent = parent;  // first caller decides where it is reported
+    }
+    z.count++;
+    z.total += ticks;
+    z.self += self;
+    if (ticks < z.min) z.min = ticks;
+    if (ticks > z.max) z.max = ticks;
+
+    uint16_t &h = z.histogram[bucket(ticks)];
+    if (h < 0xFFFF) h++;
+}
+
+// prints a zone then every zone first entered from it, indented one step
+static void dumpZone(int zone, int depth, float scale)
+{
+    const ZoneStats &z = zones[zone];
+    printf("%*s%-*s %7lu %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+           depth*2, "", 18 - depth*2, zone_names[zone],
+           (unsigned long)z.count,
+           z.min/scale,
+           (float)z.total/z.count/scale,
+           percentile(z, 99)/scale,
+           z.max/scale,
+           (float)z.self/z.count/scale);
+
+    if (depth + 1 < PROFILE_MAX_DEPTH) {
+        for (int i = 0; i < ZONE_COUNT; i++) {
+            if (zones[i].count && zones[i].parent == zone) {
+                dumpZone(i, depth + 1, scale);
+            }
+        }
+    }
+}
+
+void Profiler::dump()
+{
+    float scale = ticksPerUs();
+    printf("%-18s %7s %9s %9s %9s %9s %9s\n",
+           "zone (us)", "calls", "min", "mean", "p99", "max", "self");
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        if (zones[i].count && zones[i].parent == -1) {
+            dumpZone(i, 0, scale);
+        }
+    }
+}
+
+ProfileScope::ProfileScope(ProfileZone zone)
+    :
+    _parent(_current),
+    _zone(zone),
+    _child_ticks(0)
+{
+    _current = this;
+    _start = Profiler::now();
+}
+
+ProfileScope::~ProfileScope()
+{
+    uint32_t ticks = Profiler::now() - _start;  // unsigned, safe across wrap
+    _current = _parent;
+    if (_parent) {
+        _parent->_child_ticks += ticks;
+    }
+    Profiler::record(_zone, _parent ? _parent->_zone : -1, ticks, ticks - _child_ticks);
+}
+
+#endif
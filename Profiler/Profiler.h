@@ -0,0 +1,113 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "mbed.h"
+
+/** Profiler
+ *
+ * @brief Scoped timing of the game loop. PROFILE_ZONE(id) times the rest of the
+ * @brief enclosing block and files it under zone id. Zones opened inside another
+ * @brief zone are reported under it, with their time taken out of its self time.
+ * @brief Counts the DWT cycle counter on the board and steady_clock on the host.
+ *
+ * @brief Only built with PROFILER_MODE defined, otherwise PROFILE_ZONE expands to
+ * @brief nothing and the profiler costs no code, RAM or time.
+ *
+ * @code
+ * void Frogger::run()
+ * {
+ *     PROFILE_ZONE(ZONE_RUN);
+ *     ...
+ * }
+ * @endcode
+ */
+
+/** Profiled zones, one row each in the fixed stats table */
+enum ProfileZone
+{
+    ZONE_RUN,               /**< Frogger::run */
+    ZONE_RUN_LEVEL,         /**< Frogger::runCurrentLevel */
+    ZONE_MOVE_LANES,        /**< LaneTable::update */
+    ZONE_COLLISION,         /**< Frogger::checkCollisions */
+    ZONE_SHOW_LANE,         /**< GraphicEngine::showLane */
+    ZONE_REFRESH,           /**< N5110::refresh */
+    ZONE_COUNT
+};
+
+#ifdef PROFILER_MODE
+
+#define PROFILE_HISTOGRAM_SUB 4 // buckets per power of two (the two bits under the top one), ~19% p99 resolution
+#define PROFILE_HISTOGRAM_SIZE (32*PROFILE_HISTOGRAM_SUB)
+#define PROFILE_MAX_DEPTH 8
+
+#define PROFILE_CONCAT2(a,b) a##b
+#define PROFILE_CONCAT(a,b) PROFILE_CONCAT2(a,b)
+#define PROFILE_ZONE(id) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(id)
+
+/** per zone statistics, all times in clock ticks */
+struct ZoneStats
+{
+    uint32_t count;     /**< number of times the zone was entered */
+    uint32_t min;       /**< shortest call */
+    uint32_t max;       /**< longest call */
+    uint64_t total;     /**< sum of all calls */
+    uint64_t self;      /**< sum of all calls, less time spent in child zones */
+    int parent;         /**< zone it was first entered from, -1 at the top */
+    uint16_t histogram[PROFILE_HISTOGRAM_SIZE]; /**< log-linear, for p99 */
+};
+
+namespace Profiler
+{
+    /** @brief start the clock and clear the stats table
+     */
+    void init();
+
+    /** @brief clear the stats table
+     */
+    void reset();
+
+    /** @brief print min/mean/p99/max and self time for every zone, in microseconds
+     */
+    void dump();
+
+    /** @brief current time in clock ticks
+     */
+    uint32_t now();
+
+    /** @brief record a finished call of a zone
+     *  @param zone - the zone
+     *  @param parent - zone it was called from, -1 at the top
+     *  @param ticks - length of the call
+     *  @param self - length of the call less time in child zones
+     */
+    void record(int zone, int parent, uint32_t ticks, uint32_t self);
+}
+
+/** RAII timer for one call of a zone, use through PROFILE_ZONE */
+class ProfileScope
+{
+    public:
+        ProfileScope(ProfileZone zone);
+        ~ProfileScope();
+
+    private:
+        ProfileScope(const ProfileScope &);
+        ProfileScope &operator=(const ProfileScope &);
+
+        /** @brief innermost open scope, becomes the parent of the next one
+         */
+        static ProfileScope *_current;
+
+        ProfileScope *_parent;
+        int _zone;
+        uint32_t _start;
+        uint32_t _child_ticks;
+};
+
+#else
+
+#define PROFILE_ZONE(id)
+
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+#include "GameScenes.h"
+#include "Frogger.h"
+
+// the menu and the tutorial only render when they change
+MenuScene::MenuScene(Frogger *game)
+    :
+    Scene(true),
+    _game(game)
+{}
+
+void MenuScene::enter()
+{
+    Scene::enter();
+    _game->intro.selection = 0;
+    _game->audio.playMusic(&theme_music);
+}
+
+void MenuScene::resume()
+{
+    Scene::resume();
+    _game->audio.playMusic(&theme_music); // the bonus round stops it
+}
+
+void MenuScene::update()
+{
+    if(_game->determineSelection()) {
+        invalidate(); // the pointer moved
+    }
+}
+
+void MenuScene::render()
+{
+    _game->home();
+}
+
+void MenuScene::exit()
+{
+    _game->audio.stopMusic();
+}
+
+TutorialScene::TutorialScene(Frogger *game)
+    :
+    Scene(true),
+    _game(game)
+{}
+
+void TutorialScene::enter()
+{
+    Scene::enter();
+    _game->intro.tutorial_screens = 0; // from the first slide every time
+}
+
+void TutorialScene::update()
+{
+    if(_game->gotoNextTutorialSlide()) {
+        invalidate();
+    }
+}
+
+void TutorialScene::render()
+{
+    _game->displayTutorial();
+}
+
+PlayScene::PlayScene(Frogger *game)
+    :
+    Scene(false),
+    _game(game)
+{}
+
+void PlayScene::enter()
+{
+    Scene::enter();
+    _game->frog->reset();
+    
+    if(_game->current_level < LEVEL_COUNT) {
+        _game->loadLevel(_game->current_level);
+    }
+}
+
+// the level draws while it's simulated, the background first
+void PlayScene::update()
+{
+    _game->run();
+}
+
+void PlayScene::render()
+{}
+
+bool PlayScene::movesFrog()
+{
+    return true;
+}
+
+BonusScene::BonusScene(Frogger *game)
+    :
+    Scene(false),
+    _game(game)
+{}
+
+void BonusScene::enter()
+{
+    Scene::enter();
+    _game->frog->reset();
+    _game->current_level = LEVEL_BONUS;
+    _game->loadLevel(LEVEL_BONUS);
+    _game->audio.stopMusic();
+}
+
+void BonusScene::update()
+{
+    _game->run_bonus();
+}
+
+void BonusScene::render()
+{}
+
+void BonusScene::exit()
+{
+    _game->current_level = LEVEL_ONE; // play starts from level one
+}
+
+bool BonusScene::movesFrog()
+{
+    return true;
+}
@@ -0,0 +1,83 @@
+#ifndef GAMESCENES_H
+#define GAMESCENES_H
+
+#include "SceneStack.h"
+
+class Frogger;
+
+/** main menu: Play, Tutorial, Bonus. Static, redrawn when the pointer moves */
+class MenuScene : public Scene
+{
+    public:
+        /** Constructor
+         * @param game - the game the menu opens scenes in
+         */
+        MenuScene(Frogger *game);
+
+        void enter();
+        void resume();
+        void update();
+        void render();
+        void exit();
+
+    private:
+        Frogger *_game;
+};
+
+/** tutorial slides, A goes to the next one and back to the menu after the
+ *  last. Static, redrawn when the slide changes
+ */
+class TutorialScene : public Scene
+{
+    public:
+        /** Constructor
+         * @param game - the game with the slides
+         */
+        TutorialScene(Frogger *game);
+
+        void enter();
+        void update();
+        void render();
+
+    private:
+        Frogger *_game;
+};
+
+/** levels one and two, the frog is moved and everything is redrawn every frame */
+class PlayScene : public Scene
+{
+    public:
+        /** Constructor
+         * @param game - the game that runs the levels
+         */
+        PlayScene(Frogger *game);
+
+        void enter();
+        void update();
+        void render();
+        bool movesFrog();
+
+    private:
+        Frogger *_game;
+};
+
+/** bonus round, back to the menu once the frog gets to the top */
+class BonusScene : public Scene
+{
+    public:
+        /** Constructor
+         * @param game - the game that runs the bonus round
+         */
+        BonusScene(Frogger *game);
+
+        void enter();
+        void update();
+        void render();
+        void exit();
+        bool movesFrog();
+
+    private:
+        Frogger *_game;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "SceneStack.h"
+
+#include <stddef.h>
+
+Scene::Scene(bool is_static)
+    :
+    _static(is_static),
+    _dirty(true)
+{}
+
+void Scene::enter()
+{
+    invalidate();
+}
+
+void Scene::resume()
+{
+    invalidate(); // the scene above drew over it
+}
+
+void Scene::exit()
+{}
+
+bool Scene::movesFrog()
+{
+    return false;
+}
+
+void Scene::invalidate()
+{
+    _dirty = true;
+}
+
+bool Scene::needsRender()
+{
+    return _dirty || !_static;
+}
+
+void Scene::rendered()
+{
+    _dirty = false;
+}
+
+SceneStack::SceneStack()
+    :
+    _size(0)
+{}
+
+bool SceneStack::push(Scene *scene)
+{
+    if (_size == SCENE_STACK_SIZE) {
+        return false;
+    }
+
+    _scenes[_size++] = scene;
+    scene->enter();
+    return true;
+}
+
+void SceneStack::pop()
+{
+    if (_size == 0) {
+        return;
+    }
+
+    _scenes[--_size]->exit();
+
+    if (_size > 0) {
+        _scenes[_size - 1]->resume();
+    }
+}
+
+void SceneStack::replace(Scene *scene)
+{
+    if (_size == 0) {
+        push(scene);
+        return;
+    }
+
+    _scenes[_size - 1]->exit();
+    _scenes[_size - 1] = scene;
+    scene->enter();
+}
+
+Scene *SceneStack::top()
+{
+    return _size > 0 ? _scenes[_size - 1] : NULL;
+}
+
+int SceneStack::size()
+{
+    return _size;
+}
+
+bool SceneStack::step()
+{
+    Scene *scene = top();
+    if (!scene) {
+        return false;
+    }
+
+    scene->update();
+
+    // a scene that was just opened or uncovered starts on the next frame, the
+    // lcd keeps what the old one drew until then
+    if (scene != top() || !scene->needsRender()) {
+        return false;
+    }
+
+    scene->render();
+    scene->rendered();
+    return true;
+}
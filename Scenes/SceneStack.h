@@ -0,0 +1,115 @@
+#ifndef SCENESTACK_H
+#define SCENESTACK_H
+
+#define SCENE_STACK_SIZE 4 // the menu and what's opened from it
+
+/** Scene Class
+ *
+ * @brief One screen of the game, the menu, a tutorial or a level. The SceneStack
+ * @brief calls enter() when it's pushed, update() and render() every frame it's
+ * @brief on top, and exit() when it's popped. A static scene only renders after
+ * @brief invalidate(), so a screen that didn't change isn't redrawn or sent.
+ */
+class Scene
+{
+    public:
+        /** Constructor
+         * @param is_static - true if the scene only renders after it changes
+         */
+        Scene(bool is_static);
+
+        virtual ~Scene() {}
+
+        /** @brief pushed onto the stack, set up here rather than up front
+         */
+        virtual void enter();
+
+        /** @brief on top again, the scene above it was popped
+         */
+        virtual void resume();
+
+        /** @brief runs the scene for one frame: input, and for the levels the
+         *  @brief simulation, which draws as it goes
+         */
+        virtual void update() = 0;
+
+        /** @brief draws the scene into the lcd buffer, a static scene only
+         *  @brief after it changed
+         */
+        virtual void render() = 0;
+
+        /** @brief popped off the stack
+         */
+        virtual void exit();
+
+        /** @brief true if the buttons and the joystick move the frog, so held
+         *  @brief buttons repeat
+         */
+        virtual bool movesFrog();
+
+        /** @brief the scene changed and has to be rendered on the next frame
+         */
+        void invalidate();
+
+        /** @brief true if render() has to run this frame
+         */
+        bool needsRender();
+
+        /** @brief called once it has rendered
+         */
+        void rendered();
+
+    private:
+        bool _static;
+        bool _dirty;
+};
+
+/** SceneStack Class
+ *
+ * @brief Stack of the scenes that are open, the one on top runs every frame.
+ * @brief It replaces the flags that used to pick the screen, so there's
+ * @brief always exactly one screen running. Scenes aren't owned, they live as
+ * @brief long as the game.
+ */
+class SceneStack
+{
+    public:
+        /** Constructor, empty */
+        SceneStack();
+
+        /** @brief opens a scene on top of the current one, which stays open
+         *  @param scene - the scene, entered now
+         *  @returns false if the stack is full
+         */
+        bool push(Scene *scene);
+
+        /** @brief closes the scene on top, the one below it resumes
+         */
+        void pop();
+
+        /** @brief closes the scene on top and opens another in its place
+         *  @param scene - the scene, entered now
+         */
+        void replace(Scene *scene);
+
+        /** @brief the scene that's running, NULL if the stack is empty
+         */
+        Scene *top();
+
+        /** @brief number of open scenes
+         */
+        int size();
+
+        /** @brief runs one frame of the scene on top. If it didn't open or
+         *  @brief close a scene it renders, when it has to
+         *  @returns true if it rendered, and the lcd has to be refreshed
+         */
+        bool step();
+
+    private:
+
+        Scene *_scenes[SCENE_STACK_SIZE];
+        int _size;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef SPRITEPACK_H
+#define SPRITEPACK_H
+
+#include "N5110.h"
+
+/** Compile-time sprite packing
+ *
+ * @brief Converts a 0/1 sprite table (as drawn by N5110::drawSprite) into the
+ * @brief packed layout of N5110::drawPackedSprite while compiling, so only the
+ * @brief packed bytes end up in flash. C++11 constexpr only allows a single
+ * @brief return statement, hence the recursion and the index list.
+ *
+ * @code
+  constexpr int arrow[3][4] = {
+      { 0,1,0,0 },
+      { 1,1,1,1 },
+      { 0,1,0,0 },
+  };
+  static constexpr auto arrow_bytes = packSprite(arrow);   // { 0x02, 0x07, 0x02, 0x02 }
+  const PackedSprite arrow_sprite = makeSprite(arrow, arrow_bytes);
+ * @endcode
+ */
+
+/** packed bytes of one sprite */
+template <int N>
+struct PackedBytes {
+    unsigned char bytes[N]; /**< pages of column bytes, top page first */
+};
+
+/** list of indices 0 to N-1, used to expand one packed byte per index */
+template <int... I>
+struct IndexList {};
+
+template <int N, int... I>
+struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+
+template <int... I>
+struct MakeIndexList<0, I...> {
+    typedef IndexList<I...> type;
+};
+
+/** @brief number of bytes a rows x cols sprite packs into */
+constexpr int packedSize(int rows, int cols)
+{
+    return cols * ((rows + 7) / 8);
+}
+
+/** @brief bits bit..7 of one column byte of a page */
+template <int R, int C>
+constexpr unsigned char packColumn(const int (&pixels)[R][C], int page, int col, int bit)
+{
+    return bit == 8 ? 0 :
+           (unsigned char)(((page * 8 + bit < R && pixels[page * 8 + bit][col]) ? (1 << bit) : 0) |
+                           packColumn(pixels, page, col, bit + 1));
+}
+
+template <int R, int C, int... I>
+constexpr PackedBytes<sizeof...(I)> packIndices(const int (&pixels)[R][C], IndexList<I...>)
+{
+    return PackedBytes<sizeof...(I)> {{ packColumn(pixels, I / C, I % C, 0)... }};
+}
+
+/** @brief pack a sprite table at compile time
+ *  @param pixels - sprite table, one int per pixel (0 white, 1 black)
+ *  @returns the packed bytes
+ */
+template <int R, int C>
+constexpr PackedBytes<packedSize(R, C)> packSprite(const int (&pixels)[R][C])
+{
+    return packIndices(pixels, typename MakeIndexList<packedSize(R, C)>::type());
+}
+
+/** @brief describe packed bytes as a sprite
+ *  @param pixels - the sprite table the bytes were packed from (only its size is used)
+ *  @param bytes - the packed bytes
+ */
+template <int R, int C>
+constexpr PackedSprite makeSprite(const int (&pixels)[R][C], const PackedBytes<packedSize(R, C)> &bytes)
+{
+    return PackedSprite { C, R, bytes.bytes };
+}
+
+#endif
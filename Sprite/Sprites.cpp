@@ -0,0 +1,77 @@
+#include "Sprites.h"
+#include "SpritePack.h"
+
+#include "Background.h"
+#include "Vehicle.h"
+#include "WaterSprites.h"
+
+// the int tables are only read while compiling, so just the packed bytes
+// below are emitted
+
+// Background.h
+static constexpr auto goal_post_bytes = packSprite(goal_post);
+static constexpr auto frog_bytes = packSprite(frog);
+static constexpr auto frogger_intro_bytes = packSprite(frogger_intro);
+const PackedSprite goal_post_sprite = makeSprite(goal_post, goal_post_bytes);
+const PackedSprite frog_sprite = makeSprite(frog, frog_bytes);
+const PackedSprite frogger_intro_sprite = makeSprite(frogger_intro, frogger_intro_bytes);
+
+// Vehicle.h
+static constexpr auto frog_state_up_bytes = packSprite(frog_state_up);
+static constexpr auto frog_state_left_bytes = packSprite(frog_state_left);
+static constexpr auto bus_bytes = packSprite(bus);
+static constexpr auto right_racer_bytes = packSprite(right_racer);
+static constexpr auto right_normal_bytes = packSprite(right_normal);
+static constexpr auto star_bytes = packSprite(star);
+const PackedSprite frog_state_up_sprite = makeSprite(frog_state_up, frog_state_up_bytes);
+const PackedSprite frog_state_left_sprite = makeSprite(frog_state_left, frog_state_left_bytes);
+const PackedSprite bus_sprite = makeSprite(bus, bus_bytes);
+const PackedSprite right_racer_sprite = makeSprite(right_racer, right_racer_bytes);
+const PackedSprite right_normal_sprite = makeSprite(right_normal, right_normal_bytes);
+const PackedSprite star_sprite = makeSprite(star, star_bytes);
+
+// WaterSprites.h
+static constexpr auto medium_log_bytes = packSprite(medium_log);
+static constexpr auto log_big_bytes = packSprite(log_big);
+static constexpr auto turtles_state_one_bytes = packSprite(turtles_state_one);
+static constexpr auto turtles_state_two_bytes = packSprite(turtles_state_two);
+static constexpr auto turtles_state_three_bytes = packSprite(turtles_state_three);
+const PackedSprite medium_log_sprite = makeSprite(medium_log, medium_log_bytes);
+const PackedSprite log_big_sprite = makeSprite(log_big, log_big_bytes);
+const PackedSprite turtles_state_one_sprite = makeSprite(turtles_state_one, turtles_state_one_bytes);
+const PackedSprite turtles_state_two_sprite = makeSprite(turtles_state_two, turtles_state_two_bytes);
+const PackedSprite turtles_state_three_sprite = makeSprite(turtles_state_three, turtles_state_three_bytes);
+
+// rows of one column as a word, bit 0 is the top row
+static inline uint32_t columnMask(const PackedSprite &sprite, int col, int flip)
+{
+    uint32_t mask = 0;
+    
+    for (int page = 0; page * 8 < sprite.height && page < 4; page++) {
+        uint32_t bits = flip ? N5110::flippedColumn(sprite, page, col, flip) : sprite.data[page * sprite.width + col];
+        mask |= bits << (page * 8);
+    }
+    return mask;
+}
+
+bool spritesTouch(const PackedSprite &a, int ax, int ay, const PackedSprite &b, int bx, int by, int a_flip, int b_flip)
+{
+    int dy = ay - by; // rows a starts below b
+    
+    if (dy >= 32 || dy <= -32) {
+        return false;
+    }
+    
+    int start = ax > bx ? ax : bx;
+    int end = ax + a.width < bx + b.width ? ax + a.width : bx + b.width;
+    
+    for (int x = start; x < end; x++) {
+        uint32_t mask_a = columnMask(a, x - ax, a_flip);
+        uint32_t mask_b = columnMask(b, x - bx, b_flip);
+        
+        if (dy >= 0 ? (mask_a << dy) & mask_b : mask_a & (mask_b << -dy)) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,49 @@
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include "N5110.h"
+
+/** Packed sprites
+ *
+ * @brief Every sprite in the game, packed at compile time by Sprites.cpp from
+ * @brief the 0/1 tables in Background.h, Vehicle.h and WaterSprites.h. Each one
+ * @brief is defined once, in flash, however many files include this header.
+ */
+
+// Background.h
+extern const PackedSprite goal_post_sprite;
+extern const PackedSprite frog_sprite;
+extern const PackedSprite frogger_intro_sprite;
+
+// Vehicle.h
+extern const PackedSprite frog_state_up_sprite;
+extern const PackedSprite frog_state_left_sprite;
+extern const PackedSprite bus_sprite;
+extern const PackedSprite right_racer_sprite;
+extern const PackedSprite right_normal_sprite;
+extern const PackedSprite star_sprite;
+
+// WaterSprites.h
+extern const PackedSprite medium_log_sprite;
+extern const PackedSprite log_big_sprite;
+extern const PackedSprite turtles_state_one_sprite;
+extern const PackedSprite turtles_state_two_sprite;
+extern const PackedSprite turtles_state_three_sprite;
+
+/** @brief pixel exact overlap test of two sprites, the narrow phase of collision.
+ *  @brief Each column of the overlap is one AND of the column masks (the packed
+ *  @brief pages of the column), so it only costs a few word operations a column.
+ *  @param a - first sprite, up to 32 rows
+ *  @param ax - x pos of a
+ *  @param ay - y pos of a
+ *  @param b - second sprite, up to 32 rows
+ *  @param bx - x pos of b
+ *  @param by - y pos of b
+ *  @param a_flip - SpriteFlip a is drawn with
+ *  @param b_flip - SpriteFlip b is drawn with
+ *  @returns true if a black pixel of a is on a black pixel of b
+ */
+bool spritesTouch(const PackedSprite &a, int ax, int ay, const PackedSprite &b, int bx, int by,
+                  int a_flip = FLIP_NONE, int b_flip = FLIP_NONE);
+
+#endif
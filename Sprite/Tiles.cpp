@@ -0,0 +1,40 @@
+#include "Tiles.h"
+
+// cut from the danger_zone and safety_zone tables of Background.h, one nibble
+// per column (left column in the low nibble), bit 0 is the top row
+constexpr unsigned short background_tiles[] = {
+    0x0000, // blank
+    0x32C0, 0x3595, 0x0C21, // danger zone, top
+    0x6470, 0x6545, 0x0344, // danger zone, bottom
+    0x1996, 0x4699, 0xD999, 0xF469, 0x9999, 0x9F66, 0x0999, 0x9996, 0x6699, // safety lane
+    0x204F, 0x4200, 0x9152, 0x99A4, 0x5999, 0xD9E2, 0x6099, 0x9B99, 0xF009, 0x9F49,
+};
+
+static constexpr unsigned char blank_strip[] = {0};
+static constexpr unsigned char danger_top_strip[] = {1, 2, 3};
+static constexpr unsigned char danger_bottom_strip[] = {4, 5, 6};
+static constexpr unsigned char safety_strip[] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 11, 25, 13,
+};
+
+#define STRIP(table) table, sizeof(table) / sizeof(table[0])
+
+constexpr TileStrip background_strips[STRIP_COUNT] = {
+    {STRIP(blank_strip)},
+    {STRIP(danger_top_strip)},
+    {STRIP(danger_bottom_strip)},
+    {STRIP(safety_strip)},
+};
+
+// tiles, strips, one strip per 4 pixel row from the top
+constexpr TileMap road_and_river_map = {
+    background_tiles, background_strips, {
+        STRIP_BLANK,
+        STRIP_DANGER_TOP,    // y 4
+        STRIP_DANGER_BOTTOM,
+        STRIP_BLANK, STRIP_BLANK, STRIP_BLANK, // river
+        STRIP_SAFETY,        // y 24, the middle
+        STRIP_BLANK, STRIP_BLANK, STRIP_BLANK, STRIP_BLANK, // road
+        STRIP_SAFETY,        // y 44, the bottom
+    }
+};
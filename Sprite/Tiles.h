@@ -0,0 +1,34 @@
+#ifndef TILES_H
+#define TILES_H
+
+#include "N5110.h"
+
+/** Background tiles
+ *
+ * @brief The static parts of the levels as 4x4 tiles (N5110::drawTileMap).
+ * @brief The danger zone and safety lanes only have 26 different tiles, and
+ * @brief the danger zone repeats every 3, so a background is a few strips of
+ * @brief tile indices and a row table instead of a bitmap of the screen.
+ * @brief A new background is one more TileMap, new ground one more strip.
+ */
+
+/** index of each strip in background_strips */
+enum StripId
+{
+    STRIP_BLANK,         /**< white */
+    STRIP_DANGER_TOP,    /**< top 4 rows of the danger zone */
+    STRIP_DANGER_BOTTOM, /**< bottom 3 rows of the danger zone */
+    STRIP_SAFETY,        /**< safety lane */
+    STRIP_COUNT
+};
+
+/** every tile of the backgrounds, 0 is white */
+extern const unsigned short background_tiles[];
+
+/** every strip of the backgrounds, indexed by StripId */
+extern const TileStrip background_strips[STRIP_COUNT];
+
+/** danger zone at the top, safety lanes at the bottom and in the middle */
+extern const TileMap road_and_river_map;
+
+#endif
@@ -1,102 +1,66 @@
-#ifndef VEHICLE_H
-#define VEHICLE_H
-
-
-const int frog_state_up[4][6] = {
-  //final and initial state of frog
-  { 1, 0, 1, 1, 0, 1 },
-  { 0, 1, 1, 1, 1, 0 },
-  { 0, 1, 1, 1, 1, 0 },
-  { 1, 0, 0, 0, 0, 1 },
-    
-};
-
-const int frog_state_left[4][6] = {
-        
-    // middle state of frog 
-    { 1, 1, 0, 0, 1, 0 },
-    { 0, 1, 1, 1, 1, 1 },
-    { 0, 1, 1, 1, 1, 1 },
-    { 1, 1, 0, 0, 1, 0 },
-};
-
-const int frog_state_right[4][6] = {
-        
-    // middle state of frog 
-    { 0, 1, 0, 0, 1, 1 },
-    { 1, 1, 1, 1, 1, 0 },
-    { 1, 1, 1, 1, 1, 0 },
-    { 0, 1, 0, 0, 1, 1 },
-};
-
-const int frog_state_down[4][6] = {
-        
-    // middle state of frog 
-    { 1, 0, 0, 0, 0, 1 },
-    { 0, 1, 1, 1, 1, 0 },
-    { 0, 1, 1, 1, 1, 0 },
-    { 1, 0, 1, 1, 0, 1 },
-};
-
-
-// B
-const int bus[4][16] = {
-   
-    // bus has a longer width
-    { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
-    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1 },
-    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
-    { 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0 },
-
-};
-
-// R
-const int right_racer[4][12] = {
-    
-    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
-    { 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1 },
-    { 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1 },
-    { 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0 },
-    
-};
-
-// L
-const int left_racer[4][12] = {
-    
-    { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1 },
-    { 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1 },
-    { 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1 },
-    { 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0 },
-    
-};
-
-// N
-const int right_normal[4][10] = {
-  
-    { 0, 1, 1, 1, 1, 1, 1, 1, 0, 0 },
-    { 1, 0, 0, 0, 0, 0, 0, 1, 1, 1 },
-    { 1, 1, 0, 1, 1, 0, 1, 1, 1, 1 },
-    { 0, 0, 1, 1, 0, 1, 1, 0, 0, 0 },
-    
-};
-
-// X
-const int left_normal[4][10] = {
-   
-    { 0, 0, 0, 1, 1, 1, 1, 1, 1, 0 },
-    { 1, 1, 1, 0, 0, 0, 0, 0, 0, 1 },
-    { 1, 1, 1, 0, 1, 1, 1, 0, 1, 1 },
-    { 0, 0, 1, 1, 0, 0, 1, 1, 0, 0 },
-    
-};
-
-const int star[4][12] = {
-
-    { 1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1, 1 },
-    { 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1 },
-    { 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1 },
-    { 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0 },
-
-};
-
+#ifndef VEHICLE_H
+#define VEHICLE_H
+
+// 0/1 pixel tables - only Sprites.cpp includes this, it packs them at compile
+// time and the game draws the packed copies declared in Sprites.h
+
+constexpr int frog_state_up[4][6] = {
+  //final and initial state of frog
+  { 1, 0, 1, 1, 0, 1 },
+  { 0, 1, 1, 1, 1, 0 },
+  { 0, 1, 1, 1, 1, 0 },
+  { 1, 0, 0, 0, 0, 1 },
+    
+};
+
+// facing right is this mirrored
+constexpr int frog_state_left[4][6] = {
+        
+    // middle state of frog 
+    { 1, 1, 0, 0, 1, 0 },
+    { 0, 1, 1, 1, 1, 1 },
+    { 0, 1, 1, 1, 1, 1 },
+    { 1, 1, 0, 0, 1, 0 },
+};
+
+// B
+constexpr int bus[4][16] = {
+   
+    // bus has a longer width
+    { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
+    { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1 },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0 },
+
+};
+
+// R, the left lanes draw the vehicles mirrored
+constexpr int right_racer[4][12] = {
+    
+    { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 },
+    { 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1 },
+    { 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1 },
+    { 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0 },
+    
+};
+
+// N
+constexpr int right_normal[4][10] = {
+  
+    { 0, 1, 1, 1, 1, 1, 1, 1, 0, 0 },
+    { 1, 0, 0, 0, 0, 0, 0, 1, 1, 1 },
+    { 1, 1, 0, 1, 1, 0, 1, 1, 1, 1 },
+    { 0, 0, 1, 1, 0, 1, 1, 0, 0, 0 },
+    
+};
+
+constexpr int star[4][12] = {
+
+    { 1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1, 1 },
+    { 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1 },
+    { 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1 },
+    { 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0 },
+
+};
+
 #endif
\ No newline at end of file
@@ -1,84 +1,439 @@
-#include "Test.h"
-
-/** TEST FROG CLASS */
-
-/** Function that checks whether Frog has respawned in the right
- *  position
- */
-bool test_frog_reset(float expect_value_x, float expec_value_y)
-{
-    Frog test_frog((84/2)-6/2, 48-4, 6); // test a frog object
-    //printf("Frog reset x pos: %d,%d", x, y);
-    if(test_frog.x == expect_value_x && test_frog.y == expec_value_y){
-        //printf("FROG TEST PASSED");
-        return true;
-    } else {
-        //printf("FROG TEST FAILED, %d", test_frog.x);
-        return false;
-    }
-}
-
-void run_frog_test()
-{
-    test_frog_reset((84/2)-6/2, 48-4);
-    test_frog_reset((64/2)-6/2, 24-4);
-    test_frog_reset((32/2)-6/2, 12-4);
-}
-
-/** TEST OBJECT CLASS */
-
-/** Returns true if the input row will give the correct y pos */
-bool test_row_func(int row, int object_y_coord)
-{
-    Object test_object;
-    printf("Object row test: %d", row);
-    if(test_object.object.y == object_y_coord){
-      //  printf("OBJECT TEST PASSED");
-        return true;
-    } else {
-       // printf("OBJECT TEST FAILED, %d", row);
-        return false;
-    }
-}
-
-/** function tests that the object class creates the rectangle correcly */
-bool test_rec_paramaters(int x, int y, char c)
-{
-    Object test_object;
-    if(test_object.rectangle.right_side == (x + test_object.width) &&
-    test_object.rectangle.bottom == y + test_object.height
-    && test_object.rectangle.up == test_object.object.y){
-        //printf("OBJECT TEST PASSED");
-        return true;
-    } else {
-        //printf("OBJECT TEST FAILED, %d, %d, object type: ", x, y, c);
-        return false;
-    }
-}
-
-bool test_speed_funcs(int dir)
-{
-    Object test_object;
-    if(test_object.object.dir == dir){
-        //printf("OBJECT TEST PASSED");
-        return true;
-    } else {
-        //printf("OBJECT TEST FAILED, %d", dir);
-        return false;
-    }
-}
-
-void run_rect_params()
-{
-    test_rec_paramaters(5, 48-4*5, 'S');
-    test_rec_paramaters(6, 48-4*6, 'B');
-    test_rec_paramaters(7, 48-4*7, 'T');
-}
-
-void run_row_func()
-{
-    test_row_func(6, 48-4*6); 
-    test_row_func(7, 48-4*7); 
-    test_row_func(8, 48-4*8); 
-    test_row_func(9, 48-4*9); 
-}
+#include "Test.h"
+#include "Background.h"
+#include "Tiles.h"
+
+/** TEST FROG CLASS */
+
+/** Function that checks whether Frog has respawned in the right
+ *  position
+ */
+bool test_frog_reset(int expect_value_x, int expec_value_y)
+{
+    Frog test_frog((84/2)-6/2, 48-4, 6); // test a frog object
+    //printf("Frog reset x pos: %d,%d", x, y);
+    if(test_frog.x == expect_value_x && test_frog.y == expec_value_y){
+        //printf("FROG TEST PASSED");
+        return true;
+    } else {
+        //printf("FROG TEST FAILED, %d", test_frog.x);
+        return false;
+    }
+}
+
+void run_frog_test()
+{
+    test_frog_reset((84/2)-6/2, 48-4);
+    test_frog_reset((64/2)-6/2, 24-4);
+    test_frog_reset((32/2)-6/2, 12-4);
+}
+
+/** TEST OBJECT CLASS */
+
+/** Returns true if the input row will give the correct y pos */
+bool test_row_func(int row, int object_y_coord)
+{
+    Object test_object;
+    printf("Object row test: %d", row);
+    if(test_object.object.y == object_y_coord){
+      //  printf("OBJECT TEST PASSED");
+        return true;
+    } else {
+       // printf("OBJECT TEST FAILED, %d", row);
+        return false;
+    }
+}
+
+/** function tests that the object class creates the rectangle correcly */
+bool test_rec_paramaters(int x, int y, char c)
+{
+    Object test_object;
+    if(test_object.rectangle.right_side == (x + test_object.width) &&
+    test_object.rectangle.bottom == y + test_object.height
+    && test_object.rectangle.up == test_object.object.y){
+        //printf("OBJECT TEST PASSED");
+        return true;
+    } else {
+        //printf("OBJECT TEST FAILED, %d, %d, object type: ", x, y, c);
+        return false;
+    }
+}
+
+bool test_speed_funcs(int dir)
+{
+    Object test_object;
+    if(test_object.object.dir == dir){
+        //printf("OBJECT TEST PASSED");
+        return true;
+    } else {
+        //printf("OBJECT TEST FAILED, %d", dir);
+        return false;
+    }
+}
+
+void run_rect_params()
+{
+    test_rec_paramaters(5, 48-4*5, 'S');
+    test_rec_paramaters(6, 48-4*6, 'B');
+    test_rec_paramaters(7, 48-4*7, 'T');
+}
+
+void run_row_func()
+{
+    test_row_func(6, 48-4*6); 
+    test_row_func(7, 48-4*7); 
+    test_row_func(8, 48-4*8); 
+    test_row_func(9, 48-4*9); 
+}
+
+/** TEST N5110 PACKED SPRITES */
+
+/** Returns true if the goal post sprite packed at compile time is drawn
+ *  exactly like its int array, including at y positions that are not bank aligned
+ */
+bool test_packed_sprite(int x, int y)
+{
+    N5110 test_lcd;
+    test_lcd.clear();
+    test_lcd.drawPackedSprite(x, y, goal_post_sprite); // packed at compile time
+    
+    for(int i = 0; i < 8; i++) {
+        for(int j = 0; j < 18; j++) {
+            bool on_screen = x+j >= 0 && x+j < 84 && y+i >= 0 && y+i < 48;
+            if(on_screen && test_lcd.getPixel(x+j, y+i) != goal_post[i][j]) {
+                //printf("PACKED SPRITE TEST FAILED, %d, %d", x, y);
+                return false;
+            }
+        }
+    }
+    //printf("PACKED SPRITE TEST PASSED");
+    return true;
+}
+
+void run_packed_sprite()
+{
+    test_packed_sprite(0, 0); // bank aligned
+    test_packed_sprite(10, 3); // straddles two banks
+    test_packed_sprite(70, 44); // clipped at the bottom right
+    test_packed_sprite(-5, -3); // clipped at the top left
+}
+
+/** Returns true if the intro sprite drawn flipped is its int array mirrored.
+ *  It's 36 rows, so flipping top to bottom also moves rows across pages
+ */
+bool test_flipped_sprite(int x, int y, int flip)
+{
+    N5110 test_lcd;
+    test_lcd.clear();
+    test_lcd.drawPackedSprite(x, y, frogger_intro_sprite, flip);
+    
+    for(int i = 0; i < 36; i++) {
+        for(int j = 0; j < 43; j++) {
+            int row = (flip & FLIP_Y) ? 35 - i : i;
+            int col = (flip & FLIP_X) ? 42 - j : j;
+            bool on_screen = x+j >= 0 && x+j < 84 && y+i >= 0 && y+i < 48;
+            if(on_screen && test_lcd.getPixel(x+j, y+i) != frogger_intro[row][col]) {
+                //printf("FLIPPED SPRITE TEST FAILED, %d, %d, %d", x, y, flip);
+                return false;
+            }
+        }
+    }
+    //printf("FLIPPED SPRITE TEST PASSED");
+    return true;
+}
+
+void run_flipped_sprite()
+{
+    test_flipped_sprite(0, 0, FLIP_X); // bank aligned
+    test_flipped_sprite(10, 3, FLIP_Y); // straddles banks
+    test_flipped_sprite(60, 20, FLIP_X | FLIP_Y); // clipped at the bottom right
+    test_flipped_sprite(-5, -3, FLIP_X | FLIP_Y); // clipped at the top left
+}
+
+/** Returns true if the background tile map draws the rows y to y+rows exactly
+ *  like the 83 column table they were cut from, NULL for white rows
+ */
+bool test_tile_map(int y, int rows, const int *table)
+{
+    N5110 test_lcd;
+    test_lcd.drawTileMap(road_and_river_map);
+    
+    for(int i = 0; i < rows; i++) {
+        for(int j = 0; j < 84; j++) {
+            int expect = (table && j < 83) ? table[i*83 + j] : 0;
+            if(test_lcd.getPixel(j, y+i) != expect) {
+                //printf("TILE MAP TEST FAILED, %d, %d", j, y+i);
+                return false;
+            }
+        }
+    }
+    //printf("TILE MAP TEST PASSED");
+    return true;
+}
+
+void run_tile_map()
+{
+    test_tile_map(0, 4, NULL); // top
+    test_tile_map(4, 7, &danger_zone[0][0]); // straddles two banks
+    test_tile_map(11, 13, NULL); // river
+    test_tile_map(24, 4, &safety_zone[0][0]); // middle
+    test_tile_map(28, 16, NULL); // road
+    test_tile_map(44, 4, &safety_zone[0][0]); // bottom
+}
+
+/** Returns true if every lane of a level drawn from its strip after the given
+ *  number of frames is exactly its objects drawn one by one
+ */
+bool test_lane_strip(int level, int frames)
+{
+    LaneTable lanes;
+    static LaneStrips strips; // the pool is too big for the stack of the board
+    N5110 strip_lcd;
+    N5110 object_lcd;
+    
+    lanes.load(levels[level]);
+    strips.load(lanes);
+    for(int i = 0; i < frames; i++) {
+        lanes.update();
+    }
+    
+    strip_lcd.clear();
+    object_lcd.clear();
+    for(int lane = 0; lane < lanes.lanes; lane++) {
+        const PackedSprite *sprite = GraphicEngine::objectSprite(lanes.sprite[lane]);
+        strips.draw(strip_lcd, lanes, lane, sprite, lanes.flip[lane]);
+        
+        for(int i = lanes.first[lane]; i < lanes.first[lane] + lanes.count[lane]; i++) {
+            object_lcd.drawPackedSprite(lanes.x[i].toInt(), lanes.y[lane], *sprite, lanes.flip[lane]);
+        }
+    }
+    
+    for(int x = 0; x < 84; x++) {
+        for(int y = 0; y < 48; y++) {
+            if(strip_lcd.getPixel(x, y) != object_lcd.getPixel(x, y)) {
+                //printf("LANE STRIP TEST FAILED, %d, %d", level, frames);
+                return false;
+            }
+        }
+    }
+    //printf("LANE STRIP TEST PASSED");
+    return true;
+}
+
+void run_lane_strip()
+{
+    test_lane_strip(LEVEL_ONE, 0); // as loaded
+    test_lane_strip(LEVEL_ONE, 500); // every lane has wrapped round
+    test_lane_strip(LEVEL_TWO, 1000); // mirrored cars and turtles
+    test_lane_strip(LEVEL_BONUS, 1000);
+}
+
+/** Returns true if a filled rectangle drawn a bank at a time sets (or clears)
+ *  the same pixels as filling it pixel by pixel, and leaves the rest alone
+ */
+bool test_filled_rect(int x, int y, int width, int height, FillType fill)
+{
+    static unsigned char layer[WIDTH][BANKS];
+    N5110 rect_lcd;
+    N5110 pixel_lcd;
+    
+    rect_lcd.randomiseBuffer(); // so both black and white fills change something
+    rect_lcd.saveBuffer(layer);
+    pixel_lcd.loadBuffer(layer);
+    
+    rect_lcd.drawRect(x, y, width, height, fill);
+    for(int i = y; i < y + height; i++) {
+        for(int j = x; j < x + width; j++) {
+            pixel_lcd.setPixel(j, i, fill == FILL_BLACK);
+        }
+    }
+    
+    for(int i = 0; i < 84; i++) {
+        for(int j = 0; j < 48; j++) {
+            if(rect_lcd.getPixel(i, j) != pixel_lcd.getPixel(i, j)) {
+                //printf("FILLED RECT TEST FAILED, %d, %d", x, y);
+                return false;
+            }
+        }
+    }
+    //printf("FILLED RECT TEST PASSED");
+    return true;
+}
+
+void run_filled_rect()
+{
+    test_filled_rect(0, 0, 35, 48, FILL_BLACK); // left of the bonus void
+    test_filled_rect(55, 0, 35, 48, FILL_BLACK); // right of it, clipped
+    test_filled_rect(10, 3, 20, 4, FILL_WHITE); // inside one bank
+    test_filled_rect(-3, 5, 10, 13, FILL_WHITE); // three banks, clipped on the left
+}
+
+/** Returns true if the frog facing up, at x y, touches a big log at 0,0 only
+ *  when their black pixels overlap, not their rectangles
+ */
+bool test_sprites_touch(int x, int y, bool expect_touch)
+{
+    bool touch = spritesTouch(frog_state_up_sprite, x, y, log_big_sprite, 0, 0);
+    
+    if(touch != expect_touch) {
+        //printf("SPRITE COLLISION TEST FAILED, %d, %d", x, y);
+        return false;
+    }
+    //printf("SPRITE COLLISION TEST PASSED");
+    return true;
+}
+
+void run_sprites_touch()
+{
+    test_sprites_touch(-5, 0, false); // rectangles overlap at the blank corner of the log
+    test_sprites_touch(-4, 0, true); // top of the frog on the top of the log
+    test_sprites_touch(-5, -2, true); // bottom corner of the frog on the end of the log
+    test_sprites_touch(-6, 0, false); // rectangles don't overlap
+}
+
+/** TEST GAMEPAD */
+
+/** Returns true if the integer classifier puts x y (full scale 32768) in
+ *  the same direction as the angles of get_direction()
+ */
+bool test_octant(int x, int y, Direction expect_direction)
+{
+    Direction direction = Gamepad::get_octant(x, y, GAMEPAD_DEAD_ZONE);
+    
+    if(direction != expect_direction) {
+        //printf("OCTANT TEST FAILED, %d, %d", x, y);
+        return false;
+    }
+    //printf("OCTANT TEST PASSED");
+    return true;
+}
+
+void run_octant()
+{
+    test_octant(0, 0, CENTRE); // untouched
+    test_octant(2000, -2000, CENTRE); // ADC noise inside the dead zone
+    test_octant(0, 32767, N);
+    test_octant(32767, 0, E);
+    test_octant(-32768, -32768, SW);
+    test_octant(13500, 32767, N); // 22.4 degrees
+    test_octant(13700, 32767, NE); // 22.7 degrees
+    test_octant(32767, -13700, SE); // 112.7 degrees
+    test_octant(-32767, 13500, W); // 292.4 degrees
+}
+
+/** TEST AUDIO ENGINE */
+
+/** Returns true if, with every effect voice playing a squash, the hops
+ *  played after them wait for a voice until the queue is full
+ */
+bool test_effect_queue(int hops, int expect_dropped)
+{
+    AudioEngine audio; // not started, mix() is called here instead
+    for(int i = 1; i < AUDIO_VOICES; i++) {
+        audio.playEffect(&sound_squash);
+    }
+    for(int i = 0; i < hops; i++) {
+        audio.playEffect(&sound_hop);
+    }
+    
+    // the squashes end, the waiting hops take their voices
+    for(int i = 0; i < AUDIO_SAMPLE_RATE / 2; i++) {
+        audio.mix();
+    }
+    audio.update();
+    
+    if(audio.getDropped() != expect_dropped || !audio.isPlaying()) {
+        //printf("EFFECT QUEUE TEST FAILED, %d", hops);
+        return false;
+    }
+    //printf("EFFECT QUEUE TEST PASSED");
+    return true;
+}
+
+void run_effect_queue()
+{
+    test_effect_queue(1, 0);
+    test_effect_queue(AUDIO_PENDING, 0); // the queue is full
+    test_effect_queue(AUDIO_PENDING + 2, 2); // the last two are dropped
+}
+
+/** TEST SCENE STACK */
+
+/** static scene that counts its renders */
+class CountingScene : public Scene
+{
+    public:
+        CountingScene() : Scene(true), renders(0) {}
+        void update() {}
+        void render() { renders++; }
+        int renders;
+};
+
+/** Returns true if a static scene renders on its first frame and after it's
+ *  invalidated or uncovered, and not on the frames in between
+ */
+bool test_static_scene(int frames, bool invalidate, int expect_renders)
+{
+    SceneStack scenes;
+    CountingScene menu;
+    CountingScene tutorial;
+    
+    scenes.push(&menu);
+    for(int i = 0; i < frames; i++) {
+        scenes.step();
+    }
+    if(invalidate) {
+        menu.invalidate();
+        scenes.step();
+    }
+    
+    // the tutorial covers it and closes again
+    scenes.push(&tutorial);
+    scenes.step();
+    scenes.pop();
+    scenes.step();
+    
+    if(menu.renders != expect_renders || tutorial.renders != 1) {
+        //printf("STATIC SCENE TEST FAILED, %d", frames);
+        return false;
+    }
+    //printf("STATIC SCENE TEST PASSED");
+    return true;
+}
+
+void run_static_scene()
+{
+    test_static_scene(1, false, 2); // first frame, uncovered
+    test_static_scene(50, false, 2); // idle frames don't render
+    test_static_scene(50, true, 3); // changed once
+}
+
+/** TEST ANIMATOR */
+
+/** Returns true if the turtles are under water exactly when expected after
+ *  the given number of game frames, the dive is 96 + 48 frames in
+ */
+bool test_turtle_dive(int frames, bool expect_submerged)
+{
+    Animator animator;
+    
+    for(int i = 0; i < frames; i++) {
+        animator.tick();
+    }
+    
+    bool submerged = animator.frame(ANIM_TURTLES).flags & FRAME_SUBMERGED;
+    if(submerged != expect_submerged) {
+        //printf("TURTLE DIVE TEST FAILED, %d", frames);
+        return false;
+    }
+    //printf("TURTLE DIVE TEST PASSED");
+    return true;
+}
+
+void run_turtle_dive()
+{
+    test_turtle_dive(0, false); // first frame
+    test_turtle_dive(143, false); // last frame on the surface
+    test_turtle_dive(144, true); // dives
+    test_turtle_dive(239, true); // last frame under water
+    test_turtle_dive(240, false); // loops back up
+}
@@ -1,37 +1,67 @@
-#ifndef TEST_H
-#define TEST_H
-
-#include "Frog.h"
-#include "Frogger.h"
-#include "Object.h"
-
-/** 
- * This testing schedule is based on the Testing example from
- * LAB 106 
- */
-
-/** TEST FROG CLASS */
-bool test_frog_reset(float expect_value_x, float expec_value_y);
-void run_frog_test();
-
-/** TEST OBJECT CLASS */
-bool test_row_func(int row);
-bool test_rec_paramaters(int x, int y, char c);
-bool test_speed_funcs(int dir);
-bool test_update(int x, int y);
-
-/** TEST FROGGER FUNCTIONS */
-bool test_out_of_bounds(Object *vehicle);
-bool test_frog_actions();
-bool test_collision();
-bool test_progression();
-
-/** CALLER FUNCTIONS */
-void run_rect_params();
-void run_speed();
-void run_update();
-void run_row_func();
-void run_progression();
-void run_collision_detection();
-
+#ifndef TEST_H
+#define TEST_H
+
+#include "Frog.h"
+#include "Frogger.h"
+#include "Object.h"
+
+/** 
+ * This testing schedule is based on the Testing example from
+ * LAB 106 
+ */
+
+/** TEST FROG CLASS */
+bool test_frog_reset(int expect_value_x, int expec_value_y);
+void run_frog_test();
+
+/** TEST OBJECT CLASS */
+bool test_row_func(int row);
+bool test_rec_paramaters(int x, int y, char c);
+bool test_speed_funcs(int dir);
+bool test_update(int x, int y);
+
+/** TEST N5110 PACKED SPRITES */
+bool test_packed_sprite(int x, int y);
+void run_packed_sprite();
+bool test_flipped_sprite(int x, int y, int flip);
+void run_flipped_sprite();
+bool test_tile_map(int y, int rows, const int *table);
+void run_tile_map();
+bool test_lane_strip(int level, int frames);
+void run_lane_strip();
+bool test_filled_rect(int x, int y, int width, int height, FillType fill);
+void run_filled_rect();
+bool test_sprites_touch(int x, int y, bool expect_touch);
+void run_sprites_touch();
+
+/** TEST GAMEPAD */
+bool test_octant(int x, int y, Direction expect_direction);
+void run_octant();
+
+/** TEST AUDIO ENGINE */
+bool test_effect_queue(int hops, int expect_dropped);
+void run_effect_queue();
+
+/** TEST SCENE STACK */
+bool test_static_scene(int frames, bool invalidate, int expect_renders);
+void run_static_scene();
+
+/** TEST ANIMATOR */
+bool test_turtle_dive(int frames, bool expect_submerged);
+void run_turtle_dive();
+
+/** TEST FROGGER FUNCTIONS */
+bool test_out_of_bounds(Object *vehicle);
+bool test_frog_actions();
+bool test_collision();
+bool test_progression();
+
+/** CALLER FUNCTIONS */
+void run_rect_params();
+void run_speed();
+void run_update();
+void run_row_func();
+void run_progression();
+void run_collision_detection();
+
 #endif
\ No newline at end of file